@@ -0,0 +1,252 @@
+// Distributed Gaussian Elimination with partial pivoting (MPI + OpenMP)
+//
+// Build: mpicxx -O2 -fopenmp gauss_mpi.cpp -o gauss_mpi
+// Run:   mpirun -np 4 ./gauss_mpi 1000             (single solve, verified)
+//        mpirun -np 4 ./gauss_mpi strong 1000      (one line of a strong-scaling table)
+//        mpirun -np 4 ./gauss_mpi weak 500         (one line of a weak-scaling table)
+//        ./gauss_mpi_scaling.sh                    (both tables for np = 1, 2, 4, ...)
+//
+// Rows are dealt out block-cyclically: block b = rows [b*nb, (b+1)*nb) lives on rank
+// b % P. As elimination proceeds the active rows k+1..N-1 shrink from the top, and
+// with a cyclic deal every rank still owns about (N-k)/P of them, so the load stays
+// balanced (a plain block distribution would leave rank 0 idle after N/P steps).
+
+#include <iostream>
+#include <vector>
+#include <mpi.h>
+#include <omp.h>
+#include <iomanip> // For setprecision
+#include <cmath>   // For fabs, cbrt
+#include <cstdlib> // For atoi
+#include <cstring> // For strcmp
+#include <algorithm> // For copy
+
+using namespace std;
+
+// Block-cyclic row distribution
+struct RowLayout {
+    int N;     // Order of the system
+    int nb;    // Rows per block
+    int P;     // Number of ranks
+    int rank;  // This rank
+    int local; // Number of rows owned by this rank
+
+    int owner(int g) const { return (g / nb) % P; }
+    int localIndex(int g) const { return (g / nb / P) * nb + g % nb; }
+    int globalIndex(int r) const { return (r / nb) * P * nb + rank * nb + r % nb; }
+};
+
+RowLayout makeLayout(int N, int nb, int P, int rank) {
+    RowLayout L = {N, nb, P, rank, 0};
+    for (int g = 0; g < N; ++g) {
+        if (L.owner(g) == rank) {
+            L.local++;
+        }
+    }
+    return L;
+}
+
+// Deterministic pseudo-random entry, so every rank can build its own rows
+// without rank 0 generating and scattering the whole matrix
+double entry(int i, int j) {
+    unsigned int h = (unsigned int)i * 2654435761u ^ (unsigned int)j * 40503u;
+    h ^= h >> 13;
+    h *= 1274126177u;
+    h ^= h >> 16;
+    return (h % 2001) / 1000.0 - 1.0; // -1.0 .. 1.0
+}
+
+// Local rows of the augmented matrix [A | b], row-major, N + 1 columns each.
+// b = A * ones, so the exact solution is x = (1, 1, ..., 1).
+vector<double> buildLocalRows(const RowLayout& L) {
+    int N = L.N;
+    vector<double> Ab((size_t)L.local * (N + 1));
+    #pragma omp parallel for
+    for (int g = 0; g < N; ++g) {
+        if (L.owner(g) != L.rank) {
+            continue;
+        }
+        double* row = &Ab[(size_t)L.localIndex(g) * (N + 1)];
+        double sum = 0.0;
+        for (int j = 0; j < N; ++j) {
+            row[j] = entry(g, j);
+            sum += row[j];
+        }
+        row[N] = sum;
+    }
+    return Ab;
+}
+
+// Forward elimination with partial pivoting on the distributed rows
+void distributedElimination(const RowLayout& L, vector<double>& Ab) {
+    int N = L.N, W = N + 1;
+    vector<double> pivot(W);
+    vector<double> moved(W);
+
+    for (int k = 0; k < N; ++k) {
+        // 1. Pivot search: local max of |a(g, k)| over g >= k, then global MAXLOC
+        struct {
+            double value;
+            int row;
+        } mine = {-1.0, N}, best;
+        for (int g = k; g < N; ++g) {
+            if (L.owner(g) == L.rank) {
+                double v = fabs(Ab[(size_t)L.localIndex(g) * W + k]);
+                if (v > mine.value) {
+                    mine.value = v;
+                    mine.row = g;
+                }
+            }
+        }
+        MPI_Allreduce(&mine, &best, 1, MPI_DOUBLE_INT, MPI_MAXLOC, MPI_COMM_WORLD);
+        int p = best.row;
+        int ownerP = L.owner(p), ownerK = L.owner(k);
+
+        // 2. Broadcast the pivot row (columns k..N) from its owner
+        if (L.rank == ownerP) {
+            const double* src = &Ab[(size_t)L.localIndex(p) * W];
+            copy(src + k, src + W, pivot.begin() + k);
+        }
+        MPI_Bcast(&pivot[k], W - k, MPI_DOUBLE, ownerP, MPI_COMM_WORLD);
+
+        // 3. Row exchange: old row k goes to slot p, the pivot row goes to slot k
+        if (p != k) {
+            if (ownerK == ownerP) {
+                if (L.rank == ownerK) {
+                    double* rk = &Ab[(size_t)L.localIndex(k) * W];
+                    double* rp = &Ab[(size_t)L.localIndex(p) * W];
+                    copy(rk + k, rk + W, rp + k);
+                }
+            } else if (L.rank == ownerK) {
+                double* rk = &Ab[(size_t)L.localIndex(k) * W];
+                MPI_Send(rk + k, W - k, MPI_DOUBLE, ownerP, k, MPI_COMM_WORLD);
+            } else if (L.rank == ownerP) {
+                MPI_Recv(&moved[k], W - k, MPI_DOUBLE, ownerK, k, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+                double* rp = &Ab[(size_t)L.localIndex(p) * W];
+                copy(moved.begin() + k, moved.end(), rp + k);
+            }
+        }
+        if (L.rank == ownerK) {
+            double* rk = &Ab[(size_t)L.localIndex(k) * W];
+            copy(pivot.begin() + k, pivot.end(), rk + k);
+        }
+
+        // 4. Eliminate column k from the local rows below the pivot
+        #pragma omp parallel for
+        for (int r = 0; r < L.local; ++r) {
+            if (L.globalIndex(r) <= k) {
+                continue;
+            }
+            double* row = &Ab[(size_t)r * W];
+            double factor = row[k] / pivot[k];
+            for (int j = k; j < W; ++j) {
+                row[j] -= factor * pivot[j];
+            }
+        }
+    }
+}
+
+// Distributed back substitution, one row block at a time: the owner of a block
+// solves its nb x nb upper-triangular diagonal block, broadcasts those nb values
+// of x, and every rank removes their contribution from its own right-hand sides.
+vector<double> distributedBackSubstitution(const RowLayout& L, vector<double>& Ab) {
+    int N = L.N, W = N + 1, nb = L.nb;
+    vector<double> x(N);
+    int numBlocks = (N + nb - 1) / nb;
+
+    for (int blk = numBlocks - 1; blk >= 0; --blk) {
+        int g0 = blk * nb, g1 = min(N, g0 + nb);
+        int owner = blk % L.P;
+
+        if (L.rank == owner) {
+            for (int g = g1 - 1; g >= g0; --g) {
+                const double* row = &Ab[(size_t)L.localIndex(g) * W];
+                double s = row[N];
+                for (int j = g + 1; j < g1; ++j) {
+                    s -= row[j] * x[j];
+                }
+                x[g] = s / row[g];
+            }
+        }
+        MPI_Bcast(&x[g0], g1 - g0, MPI_DOUBLE, owner, MPI_COMM_WORLD);
+
+        // Update the right-hand side of every local row above this block
+        #pragma omp parallel for
+        for (int r = 0; r < L.local; ++r) {
+            if (L.globalIndex(r) < g0) {
+                double* row = &Ab[(size_t)r * W];
+                for (int j = g0; j < g1; ++j) {
+                    row[N] -= row[j] * x[j];
+                }
+            }
+        }
+    }
+    return x;
+}
+
+// Solve one random system of order N; returns the wall time and max |x - 1|
+void runSolve(int N, int nb, int P, int rank, double& seconds, double& error) {
+    RowLayout L = makeLayout(N, nb, P, rank);
+    vector<double> Ab = buildLocalRows(L);
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    double start = MPI_Wtime();
+    distributedElimination(L, Ab);
+    vector<double> x = distributedBackSubstitution(L, Ab);
+    double elapsed = MPI_Wtime() - start;
+
+    MPI_Reduce(&elapsed, &seconds, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    error = 0.0;
+    for (int i = 0; i < N; ++i) {
+        error = max(error, fabs(x[i] - 1.0));
+    }
+}
+
+int main(int argc, char** argv) {
+    // OpenMP threads run inside each rank, but only the main thread calls MPI
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+    int rank, P;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &P);
+    if (provided < MPI_THREAD_FUNNELED) {
+        if (rank == 0) {
+            cerr << "MPI library does not support MPI_THREAD_FUNNELED" << endl;
+        }
+        MPI_Finalize();
+        return 1;
+    }
+
+    const int nb = 32; // Rows per block of the cyclic distribution
+    double seconds, error;
+
+    if (argc >= 3 && (strcmp(argv[1], "strong") == 0 || strcmp(argv[1], "weak") == 0)) {
+        // Strong scaling: fixed N for every P.
+        // Weak scaling: work per rank fixed; the work is O(N^3), so N grows with cbrt(P).
+        bool weak = strcmp(argv[1], "weak") == 0;
+        int N = atoi(argv[2]);
+        if (weak) {
+            N = (int)(N * cbrt((double)P) + 0.5);
+        }
+        runSolve(N, nb, P, rank, seconds, error);
+        if (rank == 0) {
+            double gflops = (2.0 / 3.0) * N * (double)N * N / seconds / 1e9;
+            cout << fixed << setprecision(6) << argv[1] << "," << P << "," << N << ","
+                 << seconds << "," << setprecision(3) << gflops << "," << scientific << error << endl;
+        }
+    } else {
+        int N = (argc >= 2) ? atoi(argv[1]) : 1000;
+        runSolve(N, nb, P, rank, seconds, error);
+        if (rank == 0) {
+            cout << "--- Distributed Gaussian Elimination (MPI) ---" << endl;
+            cout << "N = " << N << ", ranks = " << P << ", block = " << nb
+                 << ", threads/rank = " << omp_get_max_threads() << endl;
+            cout << fixed << setprecision(6) << "Time: " << seconds << " s" << endl;
+            cout << scientific << setprecision(3) << "Max |x - 1|: " << error
+                 << (error < 1e-6 ? "  (PASS)" : "  (FAIL)") << endl;
+        }
+    }
+
+    MPI_Finalize();
+    return 0;
+}
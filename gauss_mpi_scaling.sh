@@ -0,0 +1,21 @@
+#!/bin/sh
+# Strong- and weak-scaling tables for gauss_mpi on the local machine.
+# Usage: ./gauss_mpi_scaling.sh [N_strong] [N_weak_per_rank] [max_np]
+
+N_STRONG=${1:-1200}
+N_WEAK=${2:-600}
+MAX_NP=${3:-8}
+MPIRUN="mpirun --oversubscribe"
+
+mpicxx -O2 -fopenmp gauss_mpi.cpp -o gauss_mpi || exit 1
+export OMP_NUM_THREADS=1
+
+echo "mode,ranks,N,time_s,gflops,max_error"
+for mode in strong weak; do
+    if [ "$mode" = strong ]; then N=$N_STRONG; else N=$N_WEAK; fi
+    np=1
+    while [ $np -le $MAX_NP ]; do
+        $MPIRUN -np $np ./gauss_mpi $mode $N
+        np=$((np * 2))
+    done
+done
@@ -0,0 +1,248 @@
+// Cache-blocked, register-tiled GEMM (GotoBLAS / BLIS structure)
+//
+//   gemm(M, N, K, A, lda, B, ldb, C, ldc, beta):  C = A * B + beta * C
+//   All matrices are row-major. beta = 0 overwrites C, beta = 1 accumulates, and any
+//   other beta scales C once before the kernels accumulate into it.
+//
+// Loop structure, outermost first:
+//   jc: NC columns of B/C at a time  -> the packed KC x NC panel of B stays in L3
+//   pc: KC of the K dimension        -> one packed row of micro-panels fits in L1
+//   ic: MC rows of A/C (parallel)    -> each thread packs its MC x KC block of A into L2
+//   jr, ir: GEMM_MR x GEMM_NR micro-tiles, computed by the micro-kernel with the
+//           whole C tile held in vector registers and one FMA per A x B pair.
+// Packing copies every block once into the exact order the micro-kernel reads it,
+// so the kernel only does unit-stride, aligned loads.
+//
+// The micro-kernel is picked at run time: AVX-512F, AVX2+FMA, or portable C++.
+
+#ifndef GEMM_H
+#define GEMM_H
+
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <omp.h>
+#include <immintrin.h>
+
+const int GEMM_MR = 6;    // Rows of the register tile
+const int GEMM_NR = 16;   // Columns of the register tile
+const int GEMM_MC = 96;   // Rows of A per packed block (multiple of GEMM_MR)
+const int GEMM_KC = 256;  // Depth of a packed block
+const int GEMM_NC = 4096; // Columns of B per packed panel (multiple of GEMM_NR)
+
+// 64-byte aligned buffer for the packed blocks
+struct GemmBuffer {
+    double* data;
+    explicit GemmBuffer(size_t n) {
+        data = static_cast<double*>(aligned_alloc(64, (n * sizeof(double) + 63) / 64 * 64));
+        if (data == nullptr) {
+            throw std::bad_alloc();
+        }
+    }
+    ~GemmBuffer() { free(data); }
+    GemmBuffer(const GemmBuffer&) = delete;
+    GemmBuffer& operator=(const GemmBuffer&) = delete;
+};
+
+// --- Micro-kernels: C[0:MR, 0:NR] += a_panel * b_panel over kc steps ---
+// a: kc groups of GEMM_MR values, b: kc groups of GEMM_NR values (both packed)
+typedef void (*GemmKernel)(int kc, const double* a, const double* b, double* c, int ldc);
+
+inline void gemmKernelPortable(int kc, const double* a, const double* b, double* c, int ldc) {
+    double acc[GEMM_MR][GEMM_NR] = {};
+    for (int p = 0; p < kc; ++p) {
+        for (int r = 0; r < GEMM_MR; ++r) {
+            for (int j = 0; j < GEMM_NR; ++j) {
+                acc[r][j] += a[r] * b[j];
+            }
+        }
+        a += GEMM_MR;
+        b += GEMM_NR;
+    }
+    for (int r = 0; r < GEMM_MR; ++r) {
+        for (int j = 0; j < GEMM_NR; ++j) {
+            c[r * ldc + j] += acc[r][j];
+        }
+    }
+}
+
+// AVX2: the 6 x 16 tile is done as two 6 x 8 halves (12 ymm accumulators each)
+__attribute__((target("avx2,fma")))
+inline void gemmKernelAvx2(int kc, const double* a, const double* b, double* c, int ldc) {
+    for (int h = 0; h < 2; ++h) {
+        __m256d acc[GEMM_MR][2];
+        #pragma GCC unroll 6
+        for (int r = 0; r < GEMM_MR; ++r) {
+            acc[r][0] = _mm256_setzero_pd();
+            acc[r][1] = _mm256_setzero_pd();
+        }
+        const double* ap = a;
+        const double* bp = b + h * 8;
+        for (int p = 0; p < kc; ++p) {
+            __m256d b0 = _mm256_load_pd(bp);
+            __m256d b1 = _mm256_load_pd(bp + 4);
+            #pragma GCC unroll 6
+            for (int r = 0; r < GEMM_MR; ++r) {
+                __m256d ar = _mm256_broadcast_sd(ap + r);
+                acc[r][0] = _mm256_fmadd_pd(ar, b0, acc[r][0]);
+                acc[r][1] = _mm256_fmadd_pd(ar, b1, acc[r][1]);
+            }
+            ap += GEMM_MR;
+            bp += GEMM_NR;
+        }
+        #pragma GCC unroll 6
+        for (int r = 0; r < GEMM_MR; ++r) {
+            double* cr = c + r * ldc + h * 8;
+            _mm256_storeu_pd(cr, _mm256_add_pd(_mm256_loadu_pd(cr), acc[r][0]));
+            _mm256_storeu_pd(cr + 4, _mm256_add_pd(_mm256_loadu_pd(cr + 4), acc[r][1]));
+        }
+    }
+}
+
+// AVX-512: the full 6 x 16 tile in 12 zmm accumulators
+__attribute__((target("avx512f")))
+inline void gemmKernelAvx512(int kc, const double* a, const double* b, double* c, int ldc) {
+    __m512d acc[GEMM_MR][2];
+    #pragma GCC unroll 6
+    for (int r = 0; r < GEMM_MR; ++r) {
+        acc[r][0] = _mm512_setzero_pd();
+        acc[r][1] = _mm512_setzero_pd();
+    }
+    for (int p = 0; p < kc; ++p) {
+        __m512d b0 = _mm512_load_pd(b);
+        __m512d b1 = _mm512_load_pd(b + 8);
+        #pragma GCC unroll 6
+        for (int r = 0; r < GEMM_MR; ++r) {
+            __m512d ar = _mm512_set1_pd(a[r]);
+            acc[r][0] = _mm512_fmadd_pd(ar, b0, acc[r][0]);
+            acc[r][1] = _mm512_fmadd_pd(ar, b1, acc[r][1]);
+        }
+        a += GEMM_MR;
+        b += GEMM_NR;
+    }
+    #pragma GCC unroll 6
+    for (int r = 0; r < GEMM_MR; ++r) {
+        double* cr = c + r * ldc;
+        _mm512_storeu_pd(cr, _mm512_add_pd(_mm512_loadu_pd(cr), acc[r][0]));
+        _mm512_storeu_pd(cr + 8, _mm512_add_pd(_mm512_loadu_pd(cr + 8), acc[r][1]));
+    }
+}
+
+// Runtime dispatch (checked once). The choice is a function-local static const, so
+// its initialization is thread safe: concurrent first calls (e.g. from Strassen
+// tasks) wait for it instead of racing.
+struct GemmChoice {
+    GemmKernel kernel;
+    const char* name;
+};
+
+inline GemmKernel gemmSelectKernel(const char** name = nullptr) {
+    static const GemmChoice choice = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return GemmChoice{gemmKernelAvx512, "AVX-512 6x16"};
+        } else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return GemmChoice{gemmKernelAvx2, "AVX2+FMA 6x16"};
+        }
+        return GemmChoice{gemmKernelPortable, "portable 6x16"};
+    }();
+    if (name != nullptr) {
+        *name = choice.name;
+    }
+    return choice.kernel;
+}
+
+// --- Packing (zero padded to whole micro-tiles) ---
+
+// mc x kc block of A -> strips of GEMM_MR rows, each stored k-major
+inline void gemmPackA(int mc, int kc, const double* A, int lda, double* buf) {
+    for (int i0 = 0; i0 < mc; i0 += GEMM_MR) {
+        for (int p = 0; p < kc; ++p) {
+            for (int r = 0; r < GEMM_MR; ++r) {
+                *buf++ = (i0 + r < mc) ? A[(size_t)(i0 + r) * lda + p] : 0.0;
+            }
+        }
+    }
+}
+
+// kc x nc panel of B -> micro-panels of GEMM_NR columns, each stored k-major
+inline void gemmPackB(int kc, int nc, const double* B, int ldb, double* buf) {
+    int panels = (nc + GEMM_NR - 1) / GEMM_NR;
+    #pragma omp parallel for schedule(static)
+    for (int q = 0; q < panels; ++q) {
+        int j0 = q * GEMM_NR;
+        double* dst = buf + (size_t)q * kc * GEMM_NR;
+        for (int p = 0; p < kc; ++p) {
+            const double* src = B + (size_t)p * ldb + j0;
+            for (int j = 0; j < GEMM_NR; ++j) {
+                *dst++ = (j0 + j < nc) ? src[j] : 0.0;
+            }
+        }
+    }
+}
+
+// --- Driver ---
+inline void gemm(int M, int N, int K, const double* A, int lda, const double* B, int ldb,
+                 double* C, int ldc, double beta) {
+    GemmKernel kernel = gemmSelectKernel();
+    if (beta == 0.0) {
+        #pragma omp parallel for schedule(static)
+        for (int i = 0; i < M; ++i) {
+            std::fill(C + (size_t)i * ldc, C + (size_t)i * ldc + N, 0.0);
+        }
+    } else if (beta != 1.0) {
+        #pragma omp parallel for schedule(static)
+        for (int i = 0; i < M; ++i) {
+            for (int j = 0; j < N; ++j) {
+                C[(size_t)i * ldc + j] *= beta;
+            }
+        }
+    }
+
+    int ncMax = std::min(GEMM_NC, (N + GEMM_NR - 1) / GEMM_NR * GEMM_NR);
+    GemmBuffer bBuf((size_t)GEMM_KC * ncMax);
+
+    for (int jc = 0; jc < N; jc += GEMM_NC) {
+        int nc = std::min(GEMM_NC, N - jc);
+        for (int pc = 0; pc < K; pc += GEMM_KC) {
+            int kc = std::min(GEMM_KC, K - pc);
+            gemmPackB(kc, nc, B + (size_t)pc * ldb + jc, ldb, bBuf.data);
+
+            #pragma omp parallel
+            {
+                GemmBuffer aBuf((size_t)GEMM_MC * GEMM_KC);
+                alignas(64) double edge[GEMM_MR * GEMM_NR];
+
+                #pragma omp for schedule(dynamic)
+                for (int ic = 0; ic < M; ic += GEMM_MC) {
+                    int mc = std::min(GEMM_MC, M - ic);
+                    gemmPackA(mc, kc, A + (size_t)ic * lda + pc, lda, aBuf.data);
+
+                    for (int jr = 0; jr < nc; jr += GEMM_NR) {
+                        const double* bp = bBuf.data + (size_t)(jr / GEMM_NR) * kc * GEMM_NR;
+                        for (int ir = 0; ir < mc; ir += GEMM_MR) {
+                            const double* ap = aBuf.data + (size_t)(ir / GEMM_MR) * kc * GEMM_MR;
+                            double* c = C + (size_t)(ic + ir) * ldc + jc + jr;
+                            int mr = std::min(GEMM_MR, mc - ir), nr = std::min(GEMM_NR, nc - jr);
+                            if (mr == GEMM_MR && nr == GEMM_NR) {
+                                kernel(kc, ap, bp, c, ldc);
+                            } else {
+                                // Partial tile: compute into a scratch tile, add the valid part
+                                std::fill(edge, edge + GEMM_MR * GEMM_NR, 0.0);
+                                kernel(kc, ap, bp, edge, GEMM_NR);
+                                for (int r = 0; r < mr; ++r) {
+                                    for (int j = 0; j < nr; ++j) {
+                                        c[(size_t)r * ldc + j] += edge[r * GEMM_NR + j];
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,196 @@
+#include <iostream>
+#include <vector>
+#include <omp.h>
+#include <iomanip>   // For setprecision, setw
+#include <cmath>     // For fabs
+#include <cstdlib>   // For rand
+#include <algorithm> // For max
+#include <string>    // For to_string
+#include "igemm.h"
+
+using namespace std;
+
+// Integer GEMM benchmark: int8 / int16 -> int32 (igemm.h) against the scalar int
+// multiply of q1.c and the double-precision gemm() with the same blocking.
+
+const int IGEMM_REPS = 5; // igemm() and gemm() times are averages over this many calls
+
+// The q1.c / lab-1 way: scalar 32-bit integer multiply (i-k-j order)
+double scalarIntMatMul(int M, int N, int K, const vector<int>& A, const vector<int>& B, vector<int>& C) {
+    double start_time = omp_get_wtime();
+    #pragma omp parallel for
+    for (int i = 0; i < M; ++i) {
+        for (int j = 0; j < N; ++j) {
+            C[(size_t)i * N + j] = 0;
+        }
+        for (int k = 0; k < K; ++k) {
+            int a = A[(size_t)i * K + k];
+            for (int j = 0; j < N; ++j) {
+                C[(size_t)i * N + j] += a * B[(size_t)k * N + j];
+            }
+        }
+    }
+    return omp_get_wtime() - start_time;
+}
+
+// Times igemm<T> on random inputs in the symmetric range of T and checks it
+// exactly against the scalar result. Returns the igemm time.
+template <typename T>
+double runInteger(int M, int N, int K, int range, double& scalarTime, bool& exact) {
+    vector<int> Ai((size_t)M * K), Bi((size_t)K * N), Ci((size_t)M * N);
+    vector<T> A(Ai.size()), B(Bi.size());
+    vector<int32_t> C((size_t)M * N);
+    for (size_t i = 0; i < Ai.size(); ++i) {
+        Ai[i] = rand() % (2 * range + 1) - range;
+        A[i] = (T)Ai[i];
+    }
+    for (size_t i = 0; i < Bi.size(); ++i) {
+        Bi[i] = rand() % (2 * range + 1) - range;
+        B[i] = (T)Bi[i];
+    }
+    scalarTime = scalarIntMatMul(M, N, K, Ai, Bi, Ci);
+
+    igemm<T>(M, N, K, A.data(), K, B.data(), N, C.data(), N, 0); // Warm up
+    double start_time = omp_get_wtime();
+    for (int r = 0; r < IGEMM_REPS; ++r) {
+        igemm<T>(M, N, K, A.data(), K, B.data(), N, C.data(), N, 0);
+    }
+    double t = (omp_get_wtime() - start_time) / IGEMM_REPS;
+
+    exact = true;
+    for (size_t i = 0; i < C.size(); ++i) {
+        exact = exact && (C[i] == Ci[i]);
+    }
+    return t;
+}
+
+// Worst case for the int32 accumulator: quantizeSymmetric() data over its full range
+// [-qmax, qmax], with row 0 of A and column 0 of B at +qmax so that C[0][0] = K * qmax^2.
+// Returns the number of entries that differ from an int64 reference.
+template <typename T>
+int fullRangeCheck(int M, int N, int K, int& qmax) {
+    vector<double> Ad((size_t)M * K), Bd((size_t)K * N);
+    for (double& v : Ad) v = (rand() % 2001) / 1000.0 - 1.0;
+    for (double& v : Bd) v = (rand() % 2001) / 1000.0 - 1.0;
+    for (int k = 0; k < K; ++k) {
+        Ad[k] = 1.0;
+        Bd[(size_t)k * N] = 1.0;
+    }
+    vector<T> A(Ad.size()), B(Bd.size());
+    quantizeSymmetric(Ad.data(), Ad.size(), A.data(), K);
+    quantizeSymmetric(Bd.data(), Bd.size(), B.data(), K);
+    qmax = A[0];
+    vector<int32_t> C((size_t)M * N);
+    igemm<T>(M, N, K, A.data(), K, B.data(), N, C.data(), N, 0);
+
+    int wrong = 0;
+    for (int i = 0; i < M; ++i) {
+        for (int j = 0; j < N; ++j) {
+            long long ref = 0;
+            for (int k = 0; k < K; ++k) {
+                ref += (long long)A[(size_t)i * K + k] * B[(size_t)k * N + j];
+            }
+            wrong += (ref != C[(size_t)i * N + j]);
+        }
+    }
+    return wrong;
+}
+
+int main() {
+    const char *name8, *name16, *nameF;
+    igemmSelectKernel<int8_t>(&name8);
+    igemmSelectKernel<int16_t>(&name16);
+    gemmSelectKernel(&nameF);
+
+    cout << fixed << setprecision(6);
+    cout << "--- Integer GEMM (" << omp_get_max_threads() << " threads) ---" << endl;
+    cout << "int8 kernel:   " << name8 << endl;
+    cout << "int16 kernel:  " << name16 << endl;
+    cout << "double kernel: " << nameF << endl;
+
+    // GOPS = 2 M N K (multiply + add) per second, for every path
+    cout << "\n" << setw(18) << "M x N x K" << setw(12) << "Type" << setw(14) << "Time (s)"
+         << setw(10) << "GOPS" << setw(14) << "vs scalar" << setw(14) << "vs double" << setw(8) << "Exact" << endl;
+    int shapes[][3] = {{1024, 1024, 1024}, {333, 517, 259}};
+    for (auto& s : shapes) {
+        int M = s[0], N = s[1], K = s[2];
+        double ops = 2.0 * M * N * K;
+        string shape = to_string(M) + "x" + to_string(N) + "x" + to_string(K);
+
+        vector<double> Ad((size_t)M * K), Bd((size_t)K * N), Cd((size_t)M * N);
+        for (double& v : Ad) v = (rand() % 2001) / 1000.0 - 1.0;
+        for (double& v : Bd) v = (rand() % 2001) / 1000.0 - 1.0;
+        gemm(M, N, K, Ad.data(), K, Bd.data(), N, Cd.data(), N, 0.0);
+        double start_time = omp_get_wtime();
+        for (int r = 0; r < IGEMM_REPS; ++r) {
+            gemm(M, N, K, Ad.data(), K, Bd.data(), N, Cd.data(), N, 0.0);
+        }
+        double doubleTime = (omp_get_wtime() - start_time) / IGEMM_REPS;
+
+        double scalar8, scalar16;
+        bool exact8, exact16;
+        double t8 = runInteger<int8_t>(M, N, K, igemmQmax<int8_t>(K), scalar8, exact8);
+        double t16 = runInteger<int16_t>(M, N, K, igemmQmax<int16_t>(K), scalar16, exact16);
+
+        cout << setw(18) << shape << setw(12) << "int scalar" << setw(14) << scalar8
+             << setw(10) << setprecision(2) << ops / scalar8 / 1e9 << setw(14) << 1.0
+             << setw(14) << doubleTime / scalar8 << setw(8) << "-" << setprecision(6) << endl;
+        cout << setw(18) << "" << setw(12) << "double" << setw(14) << doubleTime
+             << setw(10) << setprecision(2) << ops / doubleTime / 1e9 << setw(14) << scalar8 / doubleTime
+             << setw(14) << 1.0 << setw(8) << "-" << setprecision(6) << endl;
+        cout << setw(18) << "" << setw(12) << "int16" << setw(14) << t16
+             << setw(10) << setprecision(2) << ops / t16 / 1e9 << setw(14) << scalar16 / t16
+             << setw(14) << doubleTime / t16 << setw(8) << (exact16 ? "yes" : "NO") << setprecision(6) << endl;
+        cout << setw(18) << "" << setw(12) << "int8" << setw(14) << t8
+             << setw(10) << setprecision(2) << ops / t8 / 1e9 << setw(14) << scalar8 / t8
+             << setw(14) << doubleTime / t8 << setw(8) << (exact8 ? "yes" : "NO") << setprecision(6) << endl;
+    }
+
+    // Full-range check: quantized inputs at the largest magnitude allowed for their K
+    cout << "\n--- Full-range exactness (quantizeSymmetric range, C[0][0] = K * qmax^2) ---" << endl;
+    cout << setw(18) << "M x N x K" << setw(8) << "Type" << setw(8) << "qmax" << setw(12) << "Wrong" << endl;
+    int checks[][3] = {{6, 32, 2}, {6, 32, 256}, {333, 517, 1024}, {64, 64, 5000}};
+    for (auto& s : checks) {
+        int M = s[0], N = s[1], K = s[2];
+        string shape = to_string(M) + "x" + to_string(N) + "x" + to_string(K);
+        int q8, q16;
+        int wrong8 = fullRangeCheck<int8_t>(M, N, K, q8);
+        int wrong16 = fullRangeCheck<int16_t>(M, N, K, q16);
+        cout << setw(18) << shape << setw(8) << "int8" << setw(8) << q8 << setw(12) << wrong8 << endl;
+        cout << setw(18) << "" << setw(8) << "int16" << setw(8) << q16 << setw(12) << wrong16 << endl;
+    }
+
+    // Quantized inference-style product: double inputs -> int8 -> int32 -> dequantized,
+    // and requantized back to int8 with saturation
+    const int N = 512;
+    vector<double> A((size_t)N * N), B((size_t)N * N), Cref((size_t)N * N);
+    for (double& v : A) v = (rand() % 2001) / 1000.0 - 1.0;
+    for (double& v : B) v = (rand() % 2001) / 1000.0 - 1.0;
+    gemm(N, N, N, A.data(), N, B.data(), N, Cref.data(), N, 0.0);
+
+    vector<int8_t> Aq(A.size()), Bq(B.size()), Cq8(A.size());
+    vector<int32_t> Cq(A.size());
+    double sa = quantizeSymmetric(A.data(), A.size(), Aq.data(), N);
+    double sb = quantizeSymmetric(B.data(), B.size(), Bq.data(), N);
+    igemm<int8_t>(N, N, N, Aq.data(), N, Bq.data(), N, Cq.data(), N, 0);
+
+    double err = 0.0, ref = 0.0;
+    for (size_t i = 0; i < Cq.size(); ++i) {
+        err = max(err, fabs(Cq[i] * sa * sb - Cref[i]));
+        ref = max(ref, fabs(Cref[i]));
+    }
+    // Output scale chosen for |C| <= 16; larger entries saturate at +-127
+    double sOut = 16.0 / 127;
+    requantize<int8_t>(N, N, Cq.data(), N, sa * sb / sOut, Cq8.data(), N);
+    int saturated = 0;
+    for (int8_t v : Cq8) {
+        saturated += (v == 127 || v == -127);
+    }
+    cout << "\n--- Quantized int8 product (N = " << N << ") ---" << endl;
+    cout << scientific << setprecision(3);
+    cout << "Scales: A " << sa << ", B " << sb << ", output " << sOut << endl;
+    cout << "Max |dequantized - double| / max |C|: " << err / ref << endl;
+    cout << "Requantized to int8: " << saturated << " of " << Cq8.size() << " entries saturated" << endl;
+
+    return 0;
+}
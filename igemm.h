@@ -0,0 +1,547 @@
+// Integer GEMM: int8 x int8 -> int32 and int16 x int16 -> int32
+//
+//   igemm<T>(M, N, K, A, lda, B, ldb, C, ldc, beta):  C = A * B + beta * C
+//   T is int8_t or int16_t; C is int32_t. All matrices are row-major; as in gemm(),
+//   beta = 0 overwrites C, beta = 1 accumulates, other values scale C first.
+//
+// Same GotoBLAS structure as gemm() in gemm.h (jc / pc / ic loops, packed A and B
+// blocks, MR x NR register tile), with one difference in the packing: the integer
+// dot-product instructions consume a group of consecutive k values per 32-bit lane
+// (4 for int8, 2 for int16), so the packed panels store K in groups of IgemmGroup<T>::KG:
+//
+//   vpdpbusd   (AVX512-VNNI)  16 lanes x 4 int8 products, summed into int32
+//   vpmaddubsw (AVX2/AVX512BW) pairs of int8 products -> int16, then vpmaddwd by 1 -> int32
+//   vpdpwssd   (AVX512-VNNI)  16 lanes x 2 int16 products, summed into int32
+//   vpmaddwd   (AVX2/AVX512BW) pairs of int16 products -> int32
+//
+// vpdpbusd and vpmaddubsw multiply an unsigned byte by a signed byte. The VNNI path
+// packs A as the unsigned byte a + 128 and subtracts 128 * (column sum of B) from C
+// at the end. vpmaddubsw instead gets |a| and b * sign(a), since with a + 128 its int16
+// pair sums could saturate.
+//
+// Results are exact when every entry satisfies |a|, |b| <= igemmQmax<T>(K), i.e.
+// K * qmax^2 < 2^31: then no partial sum of a dot product leaves int32 (with qmax =
+// 32767 that already fails for K = 3). The int8 limit stays 127 up to K = 133143; for
+// int16 it is 32767 only up to K = 2 and e.g. 1448 at K = 1024. Within those ranges no
+// int16 pair sum saturates in vpmaddubsw and no int32 pair sum overflows in vpmaddwd.
+// (The a + 128 sums of the VNNI path may wrap for large K; SIMD adds are modulo 2^32,
+// so the offset correction still lands on the exact result.)
+// quantizeSymmetric(x, n, q, K) quantizes to exactly this range.
+//
+// A zmm register holds 64 int8 or 32 int16 values against 8 doubles, so one vpdpbusd
+// (vpdpwssd) does 8x (4x) the multiply-adds of one double FMA. That is the ceiling, not
+// what igemm() reaches: measured at 1024^3 on one AVX512-VNNI core, int8 runs at about
+// 5-6.5x and int16 at about 3-3.5x the speed of gemm(). The micro-kernel alone comes closer;
+// the rest goes to packing, edge tiles and (int8) the column-sum correction.
+
+#ifndef IGEMM_H
+#define IGEMM_H
+
+#include <cstdint>
+#include <cmath>
+#include <cstring>
+#include "gemm.h"
+
+const int IGEMM_MR = 6;  // Rows of the register tile
+const int IGEMM_NR = 32; // int32 columns of the register tile (2 zmm)
+
+// k values per 32-bit lane of the dot-product instructions
+template <typename T> struct IgemmGroup { static const int KG = 4 / sizeof(T); };
+
+// Depth of a packed block: the packed KC x NR panel of B takes the same bytes as in gemm()
+template <typename T> struct IgemmBlock { static const int KC = GEMM_KC * 4 / sizeof(T); };
+
+// Largest |a| = |b| for which a K-deep product is exact in int32: K * qmax^2 < 2^31
+template <typename T>
+inline int igemmQmax(int K) {
+    const int typeMax = (sizeof(T) == 1) ? 127 : 32767;
+    long long q = (long long)std::sqrt(2147483647.0 / std::max(K, 1));
+    while (q * q * std::max(K, 1) > 2147483647LL) {
+        q--;
+    }
+    return (int)std::min<long long>(typeMax, q);
+}
+
+// The 4 bytes of one k group of a row of packed A, as an int32 for a broadcast
+inline int32_t igemmLoadGroup(const void* p) {
+    int32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+// --- Micro-kernels: C[0:MR, 0:NR] += a_panel * b_panel over kg groups of k ---
+// a: kg groups of IGEMM_MR x KG values, b: kg groups of IGEMM_NR x KG values (packed)
+template <typename T>
+using IgemmKernel = void (*)(int kg, const T* a, const T* b, int32_t* c, int ldc);
+
+template <typename T>
+inline void igemmKernelPortable(int kg, const T* a, const T* b, int32_t* c, int ldc) {
+    const int KG = IgemmGroup<T>::KG;
+    int32_t acc[IGEMM_MR][IGEMM_NR] = {};
+    for (int g = 0; g < kg; ++g) {
+        for (int r = 0; r < IGEMM_MR; ++r) {
+            for (int j = 0; j < IGEMM_NR; ++j) {
+                int32_t s = 0;
+                for (int t = 0; t < KG; ++t) {
+                    s += (int32_t)a[r * KG + t] * (int32_t)b[j * KG + t];
+                }
+                acc[r][j] += s;
+            }
+        }
+        a += IGEMM_MR * KG;
+        b += IGEMM_NR * KG;
+    }
+    for (int r = 0; r < IGEMM_MR; ++r) {
+        for (int j = 0; j < IGEMM_NR; ++j) {
+            c[r * ldc + j] += acc[r][j];
+        }
+    }
+}
+
+// Adds the 6 x 32 tile of int32 accumulators to C
+#define IGEMM_STORE_512(acc)                                                                  \
+    for (int r = 0; r < IGEMM_MR; ++r) {                                                      \
+        int32_t* cr = c + r * ldc;                                                            \
+        __m512i* c0 = (__m512i*)cr;                                                           \
+        __m512i* c1 = (__m512i*)(cr + 16);                                                    \
+        _mm512_storeu_si512(c0, _mm512_add_epi32(_mm512_loadu_si512(c0), acc[r][0]));        \
+        _mm512_storeu_si512(c1, _mm512_add_epi32(_mm512_loadu_si512(c1), acc[r][1]));        \
+    }
+
+// int8, AVX512-VNNI: vpdpbusd(a + 128, b); A is packed with the offset already applied
+__attribute__((target("avx512f,avx512bw,avx512vnni")))
+inline void igemm8KernelVnni(int kg, const int8_t* a, const int8_t* b, int32_t* c, int ldc) {
+    __m512i acc[IGEMM_MR][2];
+    #pragma GCC unroll 6
+    for (int r = 0; r < IGEMM_MR; ++r) {
+        acc[r][0] = _mm512_setzero_si512();
+        acc[r][1] = _mm512_setzero_si512();
+    }
+    for (int g = 0; g < kg; ++g) {
+        __m512i b0 = _mm512_load_si512((const __m512i*)b);
+        __m512i b1 = _mm512_load_si512((const __m512i*)(b + 64));
+        #pragma GCC unroll 6
+        for (int r = 0; r < IGEMM_MR; ++r) {
+            __m512i ar = _mm512_set1_epi32(igemmLoadGroup(a + 4 * r));
+            acc[r][0] = _mm512_dpbusd_epi32(acc[r][0], ar, b0);
+            acc[r][1] = _mm512_dpbusd_epi32(acc[r][1], ar, b1);
+        }
+        a += IGEMM_MR * 4;
+        b += IGEMM_NR * 4;
+    }
+    IGEMM_STORE_512(acc)
+}
+
+// int8, AVX512BW: vpmaddubsw(|a|, b * sign(a)) -> int16 pairs, vpmaddwd by 1 -> int32
+__attribute__((target("avx512f,avx512bw")))
+inline void igemm8KernelAvx512(int kg, const int8_t* a, const int8_t* b, int32_t* c, int ldc) {
+    __m512i acc[IGEMM_MR][2];
+    #pragma GCC unroll 6
+    for (int r = 0; r < IGEMM_MR; ++r) {
+        acc[r][0] = _mm512_setzero_si512();
+        acc[r][1] = _mm512_setzero_si512();
+    }
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i ones = _mm512_set1_epi16(1);
+    for (int g = 0; g < kg; ++g) {
+        __m512i b0 = _mm512_load_si512((const __m512i*)b);
+        __m512i b1 = _mm512_load_si512((const __m512i*)(b + 64));
+        #pragma GCC unroll 6
+        for (int r = 0; r < IGEMM_MR; ++r) {
+            __m512i ar = _mm512_set1_epi32(igemmLoadGroup(a + 4 * r));
+            __mmask64 neg = _mm512_movepi8_mask(ar);
+            __m512i absA = _mm512_abs_epi8(ar);
+            __m512i p0 = _mm512_maddubs_epi16(absA, _mm512_mask_sub_epi8(b0, neg, zero, b0));
+            __m512i p1 = _mm512_maddubs_epi16(absA, _mm512_mask_sub_epi8(b1, neg, zero, b1));
+            acc[r][0] = _mm512_add_epi32(acc[r][0], _mm512_madd_epi16(p0, ones));
+            acc[r][1] = _mm512_add_epi32(acc[r][1], _mm512_madd_epi16(p1, ones));
+        }
+        a += IGEMM_MR * 4;
+        b += IGEMM_NR * 4;
+    }
+    IGEMM_STORE_512(acc)
+}
+
+// int8, AVX2: as above on ymm, the 6 x 32 tile done as two 6 x 16 halves
+__attribute__((target("avx2")))
+inline void igemm8KernelAvx2(int kg, const int8_t* a, const int8_t* b, int32_t* c, int ldc) {
+    const __m256i ones = _mm256_set1_epi16(1);
+    for (int h = 0; h < 2; ++h) {
+        __m256i acc[IGEMM_MR][2];
+        #pragma GCC unroll 6
+        for (int r = 0; r < IGEMM_MR; ++r) {
+            acc[r][0] = _mm256_setzero_si256();
+            acc[r][1] = _mm256_setzero_si256();
+        }
+        const int8_t* ap = a;
+        const int8_t* bp = b + h * 64;
+        for (int g = 0; g < kg; ++g) {
+            __m256i b0 = _mm256_load_si256((const __m256i*)bp);
+            __m256i b1 = _mm256_load_si256((const __m256i*)(bp + 32));
+            #pragma GCC unroll 6
+            for (int r = 0; r < IGEMM_MR; ++r) {
+                __m256i ar = _mm256_set1_epi32(igemmLoadGroup(ap + 4 * r));
+                __m256i absA = _mm256_abs_epi8(ar);
+                __m256i p0 = _mm256_maddubs_epi16(absA, _mm256_sign_epi8(b0, ar));
+                __m256i p1 = _mm256_maddubs_epi16(absA, _mm256_sign_epi8(b1, ar));
+                acc[r][0] = _mm256_add_epi32(acc[r][0], _mm256_madd_epi16(p0, ones));
+                acc[r][1] = _mm256_add_epi32(acc[r][1], _mm256_madd_epi16(p1, ones));
+            }
+            ap += IGEMM_MR * 4;
+            bp += IGEMM_NR * 4;
+        }
+        #pragma GCC unroll 6
+        for (int r = 0; r < IGEMM_MR; ++r) {
+            __m256i* c0 = (__m256i*)(c + r * ldc + h * 16);
+            __m256i* c1 = (__m256i*)(c + r * ldc + h * 16 + 8);
+            _mm256_storeu_si256(c0, _mm256_add_epi32(_mm256_loadu_si256(c0), acc[r][0]));
+            _mm256_storeu_si256(c1, _mm256_add_epi32(_mm256_loadu_si256(c1), acc[r][1]));
+        }
+    }
+}
+
+// int16, AVX512-VNNI: vpdpwssd
+__attribute__((target("avx512f,avx512bw,avx512vnni")))
+inline void igemm16KernelVnni(int kg, const int16_t* a, const int16_t* b, int32_t* c, int ldc) {
+    __m512i acc[IGEMM_MR][2];
+    #pragma GCC unroll 6
+    for (int r = 0; r < IGEMM_MR; ++r) {
+        acc[r][0] = _mm512_setzero_si512();
+        acc[r][1] = _mm512_setzero_si512();
+    }
+    for (int g = 0; g < kg; ++g) {
+        __m512i b0 = _mm512_load_si512((const __m512i*)b);
+        __m512i b1 = _mm512_load_si512((const __m512i*)(b + 32));
+        #pragma GCC unroll 6
+        for (int r = 0; r < IGEMM_MR; ++r) {
+            __m512i ar = _mm512_set1_epi32(igemmLoadGroup(a + 2 * r));
+            acc[r][0] = _mm512_dpwssd_epi32(acc[r][0], ar, b0);
+            acc[r][1] = _mm512_dpwssd_epi32(acc[r][1], ar, b1);
+        }
+        a += IGEMM_MR * 2;
+        b += IGEMM_NR * 2;
+    }
+    IGEMM_STORE_512(acc)
+}
+
+// int16, AVX512BW: vpmaddwd
+__attribute__((target("avx512f,avx512bw")))
+inline void igemm16KernelAvx512(int kg, const int16_t* a, const int16_t* b, int32_t* c, int ldc) {
+    __m512i acc[IGEMM_MR][2];
+    #pragma GCC unroll 6
+    for (int r = 0; r < IGEMM_MR; ++r) {
+        acc[r][0] = _mm512_setzero_si512();
+        acc[r][1] = _mm512_setzero_si512();
+    }
+    for (int g = 0; g < kg; ++g) {
+        __m512i b0 = _mm512_load_si512((const __m512i*)b);
+        __m512i b1 = _mm512_load_si512((const __m512i*)(b + 32));
+        #pragma GCC unroll 6
+        for (int r = 0; r < IGEMM_MR; ++r) {
+            __m512i ar = _mm512_set1_epi32(igemmLoadGroup(a + 2 * r));
+            acc[r][0] = _mm512_add_epi32(acc[r][0], _mm512_madd_epi16(ar, b0));
+            acc[r][1] = _mm512_add_epi32(acc[r][1], _mm512_madd_epi16(ar, b1));
+        }
+        a += IGEMM_MR * 2;
+        b += IGEMM_NR * 2;
+    }
+    IGEMM_STORE_512(acc)
+}
+
+// int16, AVX2: vpmaddwd on ymm, two 6 x 16 halves
+__attribute__((target("avx2")))
+inline void igemm16KernelAvx2(int kg, const int16_t* a, const int16_t* b, int32_t* c, int ldc) {
+    for (int h = 0; h < 2; ++h) {
+        __m256i acc[IGEMM_MR][2];
+        #pragma GCC unroll 6
+        for (int r = 0; r < IGEMM_MR; ++r) {
+            acc[r][0] = _mm256_setzero_si256();
+            acc[r][1] = _mm256_setzero_si256();
+        }
+        const int16_t* ap = a;
+        const int16_t* bp = b + h * 32;
+        for (int g = 0; g < kg; ++g) {
+            __m256i b0 = _mm256_load_si256((const __m256i*)bp);
+            __m256i b1 = _mm256_load_si256((const __m256i*)(bp + 16));
+            #pragma GCC unroll 6
+            for (int r = 0; r < IGEMM_MR; ++r) {
+                __m256i ar = _mm256_set1_epi32(igemmLoadGroup(ap + 2 * r));
+                acc[r][0] = _mm256_add_epi32(acc[r][0], _mm256_madd_epi16(ar, b0));
+                acc[r][1] = _mm256_add_epi32(acc[r][1], _mm256_madd_epi16(ar, b1));
+            }
+            ap += IGEMM_MR * 2;
+            bp += IGEMM_NR * 2;
+        }
+        #pragma GCC unroll 6
+        for (int r = 0; r < IGEMM_MR; ++r) {
+            __m256i* c0 = (__m256i*)(c + r * ldc + h * 16);
+            __m256i* c1 = (__m256i*)(c + r * ldc + h * 16 + 8);
+            _mm256_storeu_si256(c0, _mm256_add_epi32(_mm256_loadu_si256(c0), acc[r][0]));
+            _mm256_storeu_si256(c1, _mm256_add_epi32(_mm256_loadu_si256(c1), acc[r][1]));
+        }
+    }
+}
+
+#undef IGEMM_STORE_512
+
+// Runtime dispatch (checked once per element type). aOffset receives the value the
+// kernel expects to be added to A while packing (128 for the int8 VNNI kernel, else 0).
+template <typename T>
+inline IgemmKernel<T> igemmSelectKernel(const char** name = nullptr, int* aOffset = nullptr);
+
+// Chosen kernel, its name and the A offset it expects
+template <typename T>
+struct IgemmChoice {
+    IgemmKernel<T> kernel;
+    const char* name;
+    int aOffset;
+};
+
+template <typename T>
+inline IgemmChoice<T> igemmChooseKernel();
+
+template <>
+inline IgemmChoice<int8_t> igemmChooseKernel<int8_t>() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512vnni") && __builtin_cpu_supports("avx512bw")) {
+        return {igemm8KernelVnni, "AVX512-VNNI vpdpbusd 6x32", 128};
+    } else if (__builtin_cpu_supports("avx512bw")) {
+        return {igemm8KernelAvx512, "AVX512BW vpmaddubsw 6x32", 0};
+    } else if (__builtin_cpu_supports("avx2")) {
+        return {igemm8KernelAvx2, "AVX2 vpmaddubsw 6x32", 0};
+    }
+    return {igemmKernelPortable<int8_t>, "portable 6x32", 0};
+}
+
+template <>
+inline IgemmChoice<int16_t> igemmChooseKernel<int16_t>() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512vnni") && __builtin_cpu_supports("avx512bw")) {
+        return {igemm16KernelVnni, "AVX512-VNNI vpdpwssd 6x32", 0};
+    } else if (__builtin_cpu_supports("avx512bw")) {
+        return {igemm16KernelAvx512, "AVX512BW vpmaddwd 6x32", 0};
+    } else if (__builtin_cpu_supports("avx2")) {
+        return {igemm16KernelAvx2, "AVX2 vpmaddwd 6x32", 0};
+    }
+    return {igemmKernelPortable<int16_t>, "portable 6x32", 0};
+}
+
+template <typename T>
+inline IgemmKernel<T> igemmSelectKernel(const char** name, int* aOffset) {
+    // Thread-safe one-time initialization (concurrent first calls wait for it)
+    static const IgemmChoice<T> choice = igemmChooseKernel<T>();
+    if (name != nullptr) {
+        *name = choice.name;
+    }
+    if (aOffset != nullptr) {
+        *aOffset = choice.aOffset;
+    }
+    return choice.kernel;
+}
+
+// --- Packing (zero padded to whole micro-tiles and whole k groups) ---
+
+// mc x kc block of A -> strips of IGEMM_MR rows; per k group, KG values of each row.
+// aOffset is added to every value (a + 128 wraps to the same bits as the unsigned byte).
+// Full strips take a branch-free path over the whole k groups; only the last strip
+// and the last group check the bounds.
+template <typename T>
+inline void igemmPackA(int mc, int kc, const T* A, int lda, T* buf, int aOffset) {
+    const int KG = IgemmGroup<T>::KG;
+    const int kcFull = kc / KG * KG;
+    for (int i0 = 0; i0 < mc; i0 += IGEMM_MR) {
+        int p = 0;
+        if (i0 + IGEMM_MR <= mc) {
+            const T* a = A + (size_t)i0 * lda;
+            for (; p < kcFull; p += KG) {
+                for (int r = 0; r < IGEMM_MR; ++r) {
+                    for (int t = 0; t < KG; ++t) {
+                        buf[r * KG + t] = (T)(a[(size_t)r * lda + p + t] + aOffset);
+                    }
+                }
+                buf += IGEMM_MR * KG;
+            }
+        }
+        for (; p < kc; p += KG) {
+            for (int r = 0; r < IGEMM_MR; ++r) {
+                for (int t = 0; t < KG; ++t) {
+                    int v = (i0 + r < mc && p + t < kc) ? A[(size_t)(i0 + r) * lda + p + t] : 0;
+                    *buf++ = (T)(v + aOffset);
+                }
+            }
+        }
+    }
+}
+
+// kc x nc panel of B -> micro-panels of IGEMM_NR columns; per k group, KG values of each column
+template <typename T>
+inline void igemmPackB(int kc, int nc, const T* B, int ldb, T* buf) {
+    const int KG = IgemmGroup<T>::KG;
+    int kcp = (kc + KG - 1) / KG * KG;
+    int panels = (nc + IGEMM_NR - 1) / IGEMM_NR;
+    #pragma omp parallel for schedule(static)
+    for (int q = 0; q < panels; ++q) {
+        int j0 = q * IGEMM_NR;
+        T* dst = buf + (size_t)q * kcp * IGEMM_NR;
+        int p = 0;
+        if (j0 + IGEMM_NR <= nc) {
+            // Full micro-panel: interleave KG rows of NR values, no bounds checks
+            for (; p + KG <= kc; p += KG) {
+                for (int t = 0; t < KG; ++t) {
+                    const T* src = B + (size_t)(p + t) * ldb + j0;
+                    for (int j = 0; j < IGEMM_NR; ++j) {
+                        dst[j * KG + t] = src[j];
+                    }
+                }
+                dst += IGEMM_NR * KG;
+            }
+        }
+        for (; p < kc; p += KG) {
+            for (int j = 0; j < IGEMM_NR; ++j) {
+                for (int t = 0; t < KG; ++t) {
+                    *dst++ = (j0 + j < nc && p + t < kc) ? B[(size_t)(p + t) * ldb + j0 + j] : 0;
+                }
+            }
+        }
+    }
+}
+
+// Column sums of the K x N matrix B, for the A offset correction. Threads take
+// column strips; each row of a strip is one vectorised widening add.
+template <typename T>
+inline void igemmColSums(int K, int N, const T* B, int ldb, int32_t* colSum) {
+    const int STRIP = 512;
+    #pragma omp parallel for schedule(static)
+    for (int j0 = 0; j0 < N; j0 += STRIP) {
+        int j1 = std::min(N, j0 + STRIP);
+        std::fill(colSum + j0, colSum + j1, 0);
+        for (int k = 0; k < K; ++k) {
+            const T* b = B + (size_t)k * ldb;
+            #pragma omp simd
+            for (int j = j0; j < j1; ++j) {
+                colSum[j] += b[j];
+            }
+        }
+    }
+}
+
+// --- Driver ---
+template <typename T>
+inline void igemm(int M, int N, int K, const T* A, int lda, const T* B, int ldb,
+                  int32_t* C, int ldc, int beta) {
+    const int KG = IgemmGroup<T>::KG, KC = IgemmBlock<T>::KC;
+    int aOffset;
+    IgemmKernel<T> kernel = igemmSelectKernel<T>(nullptr, &aOffset);
+    if (beta == 0) {
+        #pragma omp parallel for schedule(static)
+        for (int i = 0; i < M; ++i) {
+            std::fill(C + (size_t)i * ldc, C + (size_t)i * ldc + N, 0);
+        }
+    } else if (beta != 1) {
+        #pragma omp parallel for schedule(static)
+        for (int i = 0; i < M; ++i) {
+            for (int j = 0; j < N; ++j) {
+                C[(size_t)i * ldc + j] *= beta;
+            }
+        }
+    }
+
+    // With an offset on A the kernels compute (A + offset) * B: start C at
+    // -offset * (column sums of B) so the offset cancels out
+    if (aOffset != 0) {
+        std::vector<int32_t> colSum(N);
+        igemmColSums(K, N, B, ldb, colSum.data());
+        #pragma omp parallel for schedule(static)
+        for (int i = 0; i < M; ++i) {
+            for (int j = 0; j < N; ++j) {
+                C[(size_t)i * ldc + j] -= aOffset * colSum[j];
+            }
+        }
+    }
+
+    // GemmBuffer counts doubles; the packed blocks are reinterpreted as T
+    int ncMax = std::min(GEMM_NC, (N + IGEMM_NR - 1) / IGEMM_NR * IGEMM_NR);
+    GemmBuffer bBuf(((size_t)KC * ncMax * sizeof(T) + 7) / 8);
+    T* bPack = reinterpret_cast<T*>(bBuf.data);
+
+    for (int jc = 0; jc < N; jc += GEMM_NC) {
+        int nc = std::min(GEMM_NC, N - jc);
+        for (int pc = 0; pc < K; pc += KC) {
+            int kc = std::min(KC, K - pc);
+            int kg = (kc + KG - 1) / KG;
+            igemmPackB(kc, nc, B + (size_t)pc * ldb + jc, ldb, bPack);
+
+            #pragma omp parallel
+            {
+                GemmBuffer aBuf(((size_t)GEMM_MC * KC * sizeof(T) + 7) / 8);
+                T* aPack = reinterpret_cast<T*>(aBuf.data);
+                alignas(64) int32_t edge[IGEMM_MR * IGEMM_NR];
+
+                #pragma omp for schedule(dynamic)
+                for (int ic = 0; ic < M; ic += GEMM_MC) {
+                    int mc = std::min(GEMM_MC, M - ic);
+                    igemmPackA(mc, kc, A + (size_t)ic * lda + pc, lda, aPack, aOffset);
+
+                    for (int jr = 0; jr < nc; jr += IGEMM_NR) {
+                        const T* bp = bPack + (size_t)(jr / IGEMM_NR) * kg * KG * IGEMM_NR;
+                        for (int ir = 0; ir < mc; ir += IGEMM_MR) {
+                            const T* ap = aPack + (size_t)(ir / IGEMM_MR) * kg * KG * IGEMM_MR;
+                            int32_t* c = C + (size_t)(ic + ir) * ldc + jc + jr;
+                            int mr = std::min(IGEMM_MR, mc - ir), nr = std::min(IGEMM_NR, nc - jr);
+                            if (mr == IGEMM_MR && nr == IGEMM_NR) {
+                                kernel(kg, ap, bp, c, ldc);
+                            } else {
+                                // Partial tile: compute into a scratch tile, add the valid part
+                                std::fill(edge, edge + IGEMM_MR * IGEMM_NR, 0);
+                                kernel(kg, ap, bp, edge, IGEMM_NR);
+                                for (int r = 0; r < mr; ++r) {
+                                    for (int j = 0; j < nr; ++j) {
+                                        c[(size_t)r * ldc + j] += edge[r * IGEMM_NR + j];
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+// --- Quantization ---
+
+// Symmetric quantization of n values to T in [-qmax, qmax], qmax = igemmQmax<T>(K),
+// so that products of depth K computed by igemm() are exact. Returns the scale:
+// x ~ q * scale.
+template <typename T>
+inline double quantizeSymmetric(const double* x, size_t n, T* q, int K) {
+    const int qmax = igemmQmax<T>(K);
+    double amax = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        amax = std::max(amax, std::fabs(x[i]));
+    }
+    double scale = (amax > 0.0) ? amax / qmax : 1.0;
+    #pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < n; ++i) {
+        long v = std::lround(x[i] / scale);
+        q[i] = (T)std::max(-qmax, (int)std::min((long)qmax, v));
+    }
+    return scale;
+}
+
+// Requantize an int32 result to T with saturation: out = clamp(round(c * scale)).
+// With scale = sa * sb / sOut this maps the product of two quantized matrices onto
+// the output scale sOut; scale = 1 just saturates int32 down to T.
+template <typename T>
+inline void requantize(int M, int N, const int32_t* C, int ldc, double scale, T* out, int ldo) {
+    const int qmax = (sizeof(T) == 1) ? 127 : 32767;
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < M; ++i) {
+        for (int j = 0; j < N; ++j) {
+            long v = std::lround(C[(size_t)i * ldc + j] * scale);
+            out[(size_t)i * ldo + j] = (T)std::max(-qmax, (int)std::min((long)qmax, v));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,455 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <omp.h>
+#include <iomanip> // For setprecision, setw
+#include <cmath>   // For sqrt, fabs
+#include <algorithm> // For max
+
+using namespace std;
+
+// Iterative Krylov solvers (CG / BiCGSTAB) on a CSR sparse matrix
+//
+// Dense elimination needs N^2 memory and N^3 time; a PDE discretization has only a
+// handful of nonzeros per row. Krylov methods only touch A through y = A*x, so the
+// cost per iteration is O(nnz). CG is for symmetric positive definite systems,
+// BiCGSTAB for general (non-symmetric) ones. Both can use a Jacobi or ILU(0)
+// preconditioner.
+//
+// Each iteration is memory bound, so the vector updates are fused with the dot
+// products that follow them: every kernel below reads its vectors once.
+
+// Compressed Sparse Row matrix, column indices sorted within each row
+struct CSRMatrix {
+    int N;
+    vector<int> rowPtr; // Size N + 1
+    vector<int> col;
+    vector<double> val;
+};
+
+// --- Test problems on an n x n grid (N = n^2 unknowns) ---
+
+// 5-point Laplacian, -u'' with Dirichlet boundaries: symmetric positive definite
+// conv > 0 adds a first-order convection term in x, which makes A non-symmetric
+CSRMatrix gridOperator(int n, double conv) {
+    CSRMatrix A;
+    A.N = n * n;
+    A.rowPtr.push_back(0);
+    for (int gy = 0; gy < n; ++gy) {
+        for (int gx = 0; gx < n; ++gx) {
+            int i = gy * n + gx;
+            if (gy > 0) { A.col.push_back(i - n); A.val.push_back(-1.0); }
+            if (gx > 0) { A.col.push_back(i - 1); A.val.push_back(-1.0 - conv); }
+            A.col.push_back(i);
+            A.val.push_back(4.0);
+            if (gx < n - 1) { A.col.push_back(i + 1); A.val.push_back(-1.0 + conv); }
+            if (gy < n - 1) { A.col.push_back(i + n); A.val.push_back(-1.0); }
+            A.rowPtr.push_back(A.col.size());
+        }
+    }
+    return A;
+}
+
+// --- Kernels ---
+
+// y = A * x
+void spmv(const CSRMatrix& A, const vector<double>& x, vector<double>& y) {
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < A.N; ++i) {
+        double s = 0.0;
+        for (int p = A.rowPtr[i]; p < A.rowPtr[i + 1]; ++p) {
+            s += A.val[p] * x[A.col[p]];
+        }
+        y[i] = s;
+    }
+}
+
+// y = A * x, returns u . y
+double spmvDot(const CSRMatrix& A, const vector<double>& x, vector<double>& y, const vector<double>& u) {
+    double dot = 0.0;
+    #pragma omp parallel for schedule(static) reduction(+:dot)
+    for (int i = 0; i < A.N; ++i) {
+        double s = 0.0;
+        for (int p = A.rowPtr[i]; p < A.rowPtr[i + 1]; ++p) {
+            s += A.val[p] * x[A.col[p]];
+        }
+        y[i] = s;
+        dot += u[i] * s;
+    }
+    return dot;
+}
+
+// y = A * x, also returns y . u and y . y
+void spmvDot2(const CSRMatrix& A, const vector<double>& x, vector<double>& y, const vector<double>& u,
+              double& yu, double& yy) {
+    double d1 = 0.0, d2 = 0.0;
+    #pragma omp parallel for schedule(static) reduction(+:d1, d2)
+    for (int i = 0; i < A.N; ++i) {
+        double s = 0.0;
+        for (int p = A.rowPtr[i]; p < A.rowPtr[i + 1]; ++p) {
+            s += A.val[p] * x[A.col[p]];
+        }
+        y[i] = s;
+        d1 += s * u[i];
+        d2 += s * s;
+    }
+    yu = d1;
+    yy = d2;
+}
+
+double dot(const vector<double>& a, const vector<double>& b) {
+    double s = 0.0;
+    #pragma omp parallel for schedule(static) reduction(+:s)
+    for (size_t i = 0; i < a.size(); ++i) {
+        s += a[i] * b[i];
+    }
+    return s;
+}
+
+// --- Preconditioners ---
+
+const int PRECOND_NONE = 0;
+const int PRECOND_JACOBI = 1;
+const int PRECOND_ILU0 = 2;
+
+// Rows of a triangular factor grouped by dependency level (wavefront order)
+struct LevelSchedule {
+    vector<int> levelPtr;
+    vector<int> rows;
+};
+
+struct Preconditioner {
+    int type;
+    vector<double> invDiag; // Jacobi
+    CSRMatrix LU;           // ILU(0): unit L below the diagonal, U on and above it
+    vector<int> diagPos;    // ILU(0): position of a(i, i) in LU.val
+    LevelSchedule lower, upper;
+};
+
+// Level schedule of the L (lower = true) or U part of a CSR matrix
+LevelSchedule buildLevels(const CSRMatrix& T, bool lower) {
+    int N = T.N;
+    vector<int> level(N, 0);
+    int numLevels = 0;
+    for (int s = 0; s < N; ++s) {
+        int i = lower ? s : N - 1 - s;
+        int lv = 0;
+        for (int p = T.rowPtr[i]; p < T.rowPtr[i + 1]; ++p) {
+            int j = T.col[p];
+            if ((lower && j < i) || (!lower && j > i)) {
+                lv = max(lv, level[j] + 1);
+            }
+        }
+        level[i] = lv;
+        numLevels = max(numLevels, lv + 1);
+    }
+    LevelSchedule S;
+    S.levelPtr.assign(numLevels + 1, 0);
+    for (int i = 0; i < N; ++i) {
+        S.levelPtr[level[i] + 1]++;
+    }
+    for (int l = 0; l < numLevels; ++l) {
+        S.levelPtr[l + 1] += S.levelPtr[l];
+    }
+    S.rows.resize(N);
+    vector<int> next(S.levelPtr.begin(), S.levelPtr.end() - 1);
+    for (int i = 0; i < N; ++i) {
+        S.rows[next[level[i]]++] = i;
+    }
+    return S;
+}
+
+// ILU(0): Gaussian elimination that keeps only the nonzero pattern of A
+void factorILU0(const CSRMatrix& A, Preconditioner& M) {
+    M.LU = A;
+    CSRMatrix& F = M.LU;
+    int N = A.N;
+    M.diagPos.assign(N, -1);
+    for (int i = 0; i < N; ++i) {
+        for (int p = F.rowPtr[i]; p < F.rowPtr[i + 1]; ++p) {
+            if (F.col[p] == i) {
+                M.diagPos[i] = p;
+            }
+        }
+    }
+
+    vector<int> where(N, -1); // Column -> position in the current row
+    for (int i = 0; i < N; ++i) {
+        for (int p = F.rowPtr[i]; p < F.rowPtr[i + 1]; ++p) {
+            where[F.col[p]] = p;
+        }
+        for (int p = F.rowPtr[i]; p < F.rowPtr[i + 1] && F.col[p] < i; ++p) {
+            int k = F.col[p];
+            F.val[p] /= F.val[M.diagPos[k]];
+            double lik = F.val[p];
+            for (int q = M.diagPos[k] + 1; q < F.rowPtr[k + 1]; ++q) {
+                int j = F.col[q];
+                if (where[j] >= 0) {
+                    F.val[where[j]] -= lik * F.val[q];
+                }
+            }
+        }
+        for (int p = F.rowPtr[i]; p < F.rowPtr[i + 1]; ++p) {
+            where[F.col[p]] = -1;
+        }
+    }
+    M.lower = buildLevels(F, true);
+    M.upper = buildLevels(F, false);
+}
+
+Preconditioner makePreconditioner(const CSRMatrix& A, int type) {
+    Preconditioner M;
+    M.type = type;
+    if (type == PRECOND_JACOBI) {
+        M.invDiag.assign(A.N, 1.0);
+        for (int i = 0; i < A.N; ++i) {
+            for (int p = A.rowPtr[i]; p < A.rowPtr[i + 1]; ++p) {
+                if (A.col[p] == i) {
+                    M.invDiag[i] = 1.0 / A.val[p];
+                }
+            }
+        }
+    } else if (type == PRECOND_ILU0) {
+        factorILU0(A, M);
+    }
+    return M;
+}
+
+// z = M^-1 * r, returns r . z (the value CG needs next)
+double applyPreconditioner(const Preconditioner& M, const vector<double>& r, vector<double>& z) {
+    int N = r.size();
+    if (M.type == PRECOND_NONE) {
+        z = r;
+        return dot(r, r);
+    }
+    if (M.type == PRECOND_JACOBI) {
+        double s = 0.0;
+        #pragma omp parallel for schedule(static) reduction(+:s)
+        for (int i = 0; i < N; ++i) {
+            z[i] = M.invDiag[i] * r[i];
+            s += r[i] * z[i];
+        }
+        return s;
+    }
+
+    // ILU(0): L * y = r, then U * z = y, each sweeping its levels in parallel
+    const CSRMatrix& F = M.LU;
+    #pragma omp parallel
+    {
+        int numLevels = M.lower.levelPtr.size() - 1;
+        for (int l = 0; l < numLevels; ++l) {
+            #pragma omp for schedule(static)
+            for (int q = M.lower.levelPtr[l]; q < M.lower.levelPtr[l + 1]; ++q) {
+                int i = M.lower.rows[q];
+                double s = r[i];
+                for (int p = F.rowPtr[i]; p < M.diagPos[i]; ++p) {
+                    s -= F.val[p] * z[F.col[p]];
+                }
+                z[i] = s;
+            }
+        }
+        numLevels = M.upper.levelPtr.size() - 1;
+        for (int l = 0; l < numLevels; ++l) {
+            #pragma omp for schedule(static)
+            for (int q = M.upper.levelPtr[l]; q < M.upper.levelPtr[l + 1]; ++q) {
+                int i = M.upper.rows[q];
+                double s = z[i];
+                for (int p = M.diagPos[i] + 1; p < F.rowPtr[i + 1]; ++p) {
+                    s -= F.val[p] * z[F.col[p]];
+                }
+                z[i] = s / F.val[M.diagPos[i]];
+            }
+        }
+    }
+    return dot(r, z);
+}
+
+// --- Convergence history ---
+struct SolveResult {
+    int iterations;
+    double seconds;
+    double relResidual;
+    vector<double> time;     // Elapsed time after each iteration
+    vector<double> residual; // ||r|| / ||b|| after each iteration
+};
+
+// --- Preconditioned Conjugate Gradient ---
+SolveResult conjugateGradient(const CSRMatrix& A, const vector<double>& b, vector<double>& x,
+                              const Preconditioner& M, double tol, int maxIter) {
+    int N = A.N;
+    SolveResult R;
+    double start = omp_get_wtime();
+    vector<double> r(N), z(N), p(N), Ap(N);
+
+    spmv(A, x, Ap);
+    for (int i = 0; i < N; ++i) {
+        r[i] = b[i] - Ap[i];
+    }
+    double bnorm = sqrt(dot(b, b));
+    double rz = applyPreconditioner(M, r, z);
+    p = z;
+
+    int it = 0;
+    double rr = dot(r, r);
+    while (it < maxIter && sqrt(rr) > tol * bnorm) {
+        double pAp = spmvDot(A, p, Ap, p);
+        double alpha = rz / pAp;
+
+        // Fused: x += alpha p, r -= alpha Ap, and ||r||^2 in one pass
+        rr = 0.0;
+        #pragma omp parallel for schedule(static) reduction(+:rr)
+        for (int i = 0; i < N; ++i) {
+            x[i] += alpha * p[i];
+            r[i] -= alpha * Ap[i];
+            rr += r[i] * r[i];
+        }
+
+        double rzNew = applyPreconditioner(M, r, z);
+        double beta = rzNew / rz;
+        rz = rzNew;
+        #pragma omp parallel for schedule(static)
+        for (int i = 0; i < N; ++i) {
+            p[i] = z[i] + beta * p[i];
+        }
+
+        it++;
+        R.time.push_back(omp_get_wtime() - start);
+        R.residual.push_back(sqrt(rr) / bnorm);
+    }
+    R.iterations = it;
+    R.seconds = omp_get_wtime() - start;
+    R.relResidual = sqrt(rr) / bnorm;
+    return R;
+}
+
+// --- Preconditioned BiCGSTAB (right preconditioning) ---
+SolveResult biCGSTAB(const CSRMatrix& A, const vector<double>& b, vector<double>& x,
+                     const Preconditioner& M, double tol, int maxIter) {
+    int N = A.N;
+    SolveResult R;
+    double start = omp_get_wtime();
+    vector<double> r(N), rhat(N), p(N, 0.0), v(N, 0.0), s(N), t(N), phat(N), shat(N);
+
+    spmv(A, x, t);
+    for (int i = 0; i < N; ++i) {
+        r[i] = b[i] - t[i];
+    }
+    rhat = r;
+    double bnorm = sqrt(dot(b, b));
+    double rho = 1.0, alpha = 1.0, omega = 1.0;
+    double rhoNew = dot(rhat, r), rr = dot(r, r);
+
+    int it = 0;
+    while (it < maxIter && sqrt(rr) > tol * bnorm) {
+        double beta = (rhoNew / rho) * (alpha / omega);
+        rho = rhoNew;
+        #pragma omp parallel for schedule(static)
+        for (int i = 0; i < N; ++i) {
+            p[i] = r[i] + beta * (p[i] - omega * v[i]);
+        }
+
+        applyPreconditioner(M, p, phat);
+        alpha = rho / spmvDot(A, phat, v, rhat);
+
+        // Fused: s = r - alpha v and ||s||^2
+        double ss = 0.0;
+        #pragma omp parallel for schedule(static) reduction(+:ss)
+        for (int i = 0; i < N; ++i) {
+            s[i] = r[i] - alpha * v[i];
+            ss += s[i] * s[i];
+        }
+        if (sqrt(ss) <= tol * bnorm) {
+            #pragma omp parallel for schedule(static)
+            for (int i = 0; i < N; ++i) {
+                x[i] += alpha * phat[i];
+            }
+            rr = ss;
+            it++;
+            R.time.push_back(omp_get_wtime() - start);
+            R.residual.push_back(sqrt(rr) / bnorm);
+            break;
+        }
+
+        applyPreconditioner(M, s, shat);
+        double ts, tt;
+        spmvDot2(A, shat, t, s, ts, tt);
+        omega = ts / tt;
+
+        // Fused: x and r updates plus ||r||^2 and rhat . r for the next step
+        double d1 = 0.0, d2 = 0.0;
+        #pragma omp parallel for schedule(static) reduction(+:d1, d2)
+        for (int i = 0; i < N; ++i) {
+            x[i] += alpha * phat[i] + omega * shat[i];
+            r[i] = s[i] - omega * t[i];
+            d1 += r[i] * r[i];
+            d2 += rhat[i] * r[i];
+        }
+        rr = d1;
+        rhoNew = d2;
+
+        it++;
+        R.time.push_back(omp_get_wtime() - start);
+        R.residual.push_back(sqrt(rr) / bnorm);
+    }
+    R.iterations = it;
+    R.seconds = omp_get_wtime() - start;
+    R.relResidual = sqrt(rr) / bnorm;
+    return R;
+}
+
+// One row of the convergence-vs-time table: when each residual level was reached
+void printConvergenceRow(const string& name, const SolveResult& R, const vector<double>& levels) {
+    cout << setw(22) << name << setw(7) << R.iterations;
+    for (double level : levels) {
+        size_t k = 0;
+        while (k < R.residual.size() && R.residual[k] > level) {
+            k++;
+        }
+        if (k < R.residual.size()) {
+            cout << setw(12) << fixed << setprecision(4) << R.time[k];
+        } else {
+            cout << setw(12) << "-";
+        }
+    }
+    cout << setw(12) << scientific << setprecision(2) << R.relResidual << endl;
+}
+
+int main() {
+    int n = 256; // Grid size: N = n^2 unknowns
+    double tol = 1e-8;
+    int maxIter = 2000;
+    vector<double> levels = {1e-2, 1e-4, 1e-6, 1e-8};
+
+    cout << "--- Krylov Solvers on CSR (grid " << n << "x" << n << ", threads = "
+         << omp_get_max_threads() << ") ---" << endl;
+
+    const char* precondNames[] = {"none", "Jacobi", "ILU(0)"};
+    for (int problem = 0; problem < 2; ++problem) {
+        bool symmetric = (problem == 0);
+        CSRMatrix A = gridOperator(n, symmetric ? 0.0 : 0.5);
+        vector<double> b(A.N, 1.0);
+
+        cout << "\n" << (symmetric ? "Poisson (SPD), CG" : "Convection-diffusion (non-symmetric), BiCGSTAB")
+             << ": N = " << A.N << ", nnz = " << A.val.size() << endl;
+        cout << "Time (s) until ||r||/||b|| drops below each level:" << endl;
+        cout << setw(22) << "Preconditioner" << setw(7) << "Iters";
+        for (double level : levels) {
+            cout << setw(12) << scientific << setprecision(0) << level;
+        }
+        cout << setw(12) << "Final" << endl;
+
+        for (int type = PRECOND_NONE; type <= PRECOND_ILU0; ++type) {
+            double start = omp_get_wtime();
+            Preconditioner M = makePreconditioner(A, type);
+            double setup = omp_get_wtime() - start;
+
+            vector<double> x(A.N, 0.0);
+            SolveResult R = symmetric ? conjugateGradient(A, b, x, M, tol, maxIter)
+                                      : biCGSTAB(A, b, x, M, tol, maxIter);
+
+            string name = string(precondNames[type]) + " (setup " + to_string((int)(setup * 1000)) + " ms)";
+            printConvergenceRow(name, R, levels);
+        }
+    }
+    return 0;
+}
@@ -4,17 +4,27 @@
 #include <iomanip> // For setprecision
 #include <cstdlib> // For rand
 #include <ctime>   // For time
+#include <cmath>   // For fabs
+#include <algorithm> // For min, max
+#include <new>     // For bad_alloc
+#include "gemm.h"  // Blocked GEMM with SIMD micro-kernels
+#include "numa_util.h" // First-touch / interleaved placement, thread binding
 
 using namespace std;
 
 // Use 'double' for better precision in multiplication
 typedef vector<vector<double>> Matrix;
 
-// Initialize matrix with random values
+// Initialize matrix with random values. Rows are filled in parallel with the same
+// static schedule as the multiply loops, each from its own rand_r() stream, so the
+// thread that writes a row is the one that will work on it.
 void initMatrix(Matrix& mat, int N) {
+    unsigned int seed = rand();
+    #pragma omp parallel for schedule(static)
     for (int i = 0; i < N; ++i) {
+        unsigned int rowSeed = seed + 7919u * i;
         for (int j = 0; j < N; ++j) {
-            mat[i][j] = (rand() % 100) / 10.0; // Random 0.0 to 9.9
+            mat[i][j] = (rand_r(&rowSeed) % 100) / 10.0; // Random 0.0 to 9.9
         }
     }
 }
@@ -54,7 +64,7 @@ double parallelMatMul(const Matrix& A, const Matrix& B, Matrix& C, int N) {
     
     // Parallelize the outer two loops
     // 'collapse(2)' tells OpenMP to parallelize the i and j loops as one
-    #pragma omp parallel for collapse(2)
+    #pragma omp parallel for collapse(2) schedule(static)
     for (int i = 0; i < N; ++i) {
         for (int j = 0; j < N; ++j) {
             C[i][j] = 0.0; // Initialize
@@ -67,24 +77,357 @@ double parallelMatMul(const Matrix& A, const Matrix& B, Matrix& C, int N) {
     return end_time - start_time;
 }
 
+// --- Aligned flat storage ---
+// vector<vector<double>> puts every row in its own heap block, so the kernels
+// below work on one contiguous, 64-byte aligned (cache line / AVX-512) array.
+template <typename T>
+struct AlignedAllocator {
+    typedef T value_type;
+    AlignedAllocator() {}
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        size_t bytes = (n * sizeof(T) + 63) / 64 * 64; // aligned_alloc wants a multiple of 64
+        void* p = aligned_alloc(64, bytes);
+        if (p == nullptr) {
+            throw bad_alloc();
+        }
+        if (numaPolicy() == NUMA_INTERLEAVE) {
+            numaInterleave(p, bytes); // Before the vector's first touch
+        }
+        return static_cast<T*>(p);
+    }
+    void deallocate(T* p, size_t) { free(p); }
+};
+
+template <typename T, typename U>
+bool operator==(const AlignedAllocator<T>&, const AlignedAllocator<U>&) { return true; }
+template <typename T, typename U>
+bool operator!=(const AlignedAllocator<T>&, const AlignedAllocator<U>&) { return false; }
+
+typedef vector<double, AlignedAllocator<double>> AlignedVector;
+
+// 5. Packed Matrix Multiplication (single thread)
+//
+// serialMatMul walks B[k][j] down a column (stride N, a new row pointer per step)
+// and adds into C[i][j] through two indirections on every iteration. Here:
+//  - B is copied once into panels of PACK_NR columns: panel p holds B[k][p*NR .. p*NR+NR)
+//    for k = 0..N-1 back to back, so the inner loop reads B with unit stride;
+//  - A is copied into strips of PACK_MR rows, interleaved by k;
+//  - each PACK_MR x PACK_NR block of C is accumulated in a local array the compiler
+//    keeps in registers (i-k-j order inside the block) and stored to C once.
+// Rows and columns past N are zero padded so the inner loops have fixed trip counts.
+const int PACK_MR = 4;
+const int PACK_NR = 8;
+
+double packedMatMul(const Matrix& A, const Matrix& B, Matrix& C, int N) {
+    double start_time = omp_get_wtime();
+    int strips = (N + PACK_MR - 1) / PACK_MR;
+    int panels = (N + PACK_NR - 1) / PACK_NR;
+
+    AlignedVector ap((size_t)strips * N * PACK_MR, 0.0);
+    for (int i = 0; i < N; ++i) {
+        double* strip = &ap[(size_t)(i / PACK_MR) * N * PACK_MR];
+        for (int k = 0; k < N; ++k) {
+            strip[k * PACK_MR + i % PACK_MR] = A[i][k];
+        }
+    }
+    AlignedVector bp((size_t)panels * N * PACK_NR, 0.0);
+    for (int k = 0; k < N; ++k) {
+        for (int j = 0; j < N; ++j) {
+            bp[((size_t)(j / PACK_NR) * N + k) * PACK_NR + j % PACK_NR] = B[k][j];
+        }
+    }
+
+    for (int s = 0; s < strips; ++s) {
+        const double* strip = &ap[(size_t)s * N * PACK_MR];
+        for (int p = 0; p < panels; ++p) {
+            const double* panel = &bp[(size_t)p * N * PACK_NR];
+            double acc[PACK_MR][PACK_NR] = {};
+            for (int k = 0; k < N; ++k) {
+                const double* a = strip + k * PACK_MR;
+                const double* b = panel + k * PACK_NR;
+                for (int r = 0; r < PACK_MR; ++r) {
+                    for (int c = 0; c < PACK_NR; ++c) {
+                        acc[r][c] += a[r] * b[c];
+                    }
+                }
+            }
+            for (int r = 0; r < PACK_MR && s * PACK_MR + r < N; ++r) {
+                for (int c = 0; c < PACK_NR && p * PACK_NR + c < N; ++c) {
+                    C[s * PACK_MR + r][p * PACK_NR + c] = acc[r][c];
+                }
+            }
+        }
+    }
+    double end_time = omp_get_wtime();
+    return end_time - start_time;
+}
+
+// 6. Blocked GEMM (gemm.h): three-level cache blocking, packed A/B blocks,
+// a 6x16 SIMD register-tile micro-kernel and OpenMP over the MC row blocks.
+// The time includes copying in and out of the flat arrays.
+double blockedMatMul(const Matrix& A, const Matrix& B, Matrix& C, int N) {
+    double start_time = omp_get_wtime();
+    AlignedVector a((size_t)N * N), b((size_t)N * N), c((size_t)N * N);
+    #pragma omp parallel for
+    for (int i = 0; i < N; ++i) {
+        copy(A[i].begin(), A[i].end(), a.begin() + (size_t)i * N);
+        copy(B[i].begin(), B[i].end(), b.begin() + (size_t)i * N);
+    }
+
+    gemm(N, N, N, a.data(), N, b.data(), N, c.data(), N, 0.0);
+
+    #pragma omp parallel for
+    for (int i = 0; i < N; ++i) {
+        copy(c.begin() + (size_t)i * N, c.begin() + (size_t)(i + 1) * N, C[i].begin());
+    }
+    double end_time = omp_get_wtime();
+    return end_time - start_time;
+}
+
+// 7. Strassen-Winograd Multiplication
+//
+// One level splits each matrix into 2x2 blocks of size h = n/2 and needs 7 block
+// products instead of 8 (Winograd's form also keeps the additions down to 15).
+// Recursing gives O(n^2.81). Below `cutoff` (or for odd n) the blocked gemm() is
+// faster, so it becomes the leaf. The price is accuracy: the extra additions make
+// the error bound grow with the depth, so strassenDemo() reports the error against gemm().
+//
+// The top taskDepth levels run their 7 products as OpenMP tasks; deeper levels are
+// sequential and reuse two scratch blocks with the schedule of Boyer et al. (the
+// products are written into the quadrants of C). All scratch space comes from one
+// arena allocated up front: every call gets a fixed slice, sized by strassenWorkspace().
+struct MatView {
+    double* p;
+    int ld;
+    MatView quad(int qi, int qj, int h) const { return {p + (size_t)qi * h * ld + (size_t)qj * h, ld}; }
+    double* row(int i) const { return p + (size_t)i * ld; }
+};
+
+// Z = X + alpha * Y on h x h blocks (spread over tasks at the parallel levels)
+void addBlocks(int h, MatView X, MatView Y, MatView Z, double alpha, bool parallel) {
+    if (parallel) {
+        #pragma omp taskloop grainsize(32)
+        for (int i = 0; i < h; ++i) {
+            const double* x = X.row(i);
+            const double* y = Y.row(i);
+            double* z = Z.row(i);
+            for (int j = 0; j < h; ++j) {
+                z[j] = x[j] + alpha * y[j];
+            }
+        }
+    } else {
+        for (int i = 0; i < h; ++i) {
+            const double* x = X.row(i);
+            const double* y = Y.row(i);
+            double* z = Z.row(i);
+            for (int j = 0; j < h; ++j) {
+                z[j] = x[j] + alpha * y[j];
+            }
+        }
+    }
+}
+
+bool strassenLeaf(int n, int cutoff) { return n <= cutoff || n % 2 != 0; }
+
+// Doubles of scratch space needed by strassenRec() for an n x n product
+size_t strassenWorkspace(int n, int cutoff, int depth, int taskDepth) {
+    if (strassenLeaf(n, cutoff)) {
+        return 0;
+    }
+    size_t h2 = (size_t)(n / 2) * (n / 2);
+    if (depth < taskDepth) {
+        return 11 * h2 + 7 * strassenWorkspace(n / 2, cutoff, depth + 1, taskDepth);
+    }
+    return 2 * h2 + strassenWorkspace(n / 2, cutoff, depth + 1, taskDepth);
+}
+
+// C = A * B for n x n views; ws points to this call's slice of the arena
+void strassenRec(int n, MatView A, MatView B, MatView C, double* ws, int cutoff, int depth, int taskDepth) {
+    if (strassenLeaf(n, cutoff)) {
+        gemm(n, n, n, A.p, A.ld, B.p, B.ld, C.p, C.ld, 0.0);
+        return;
+    }
+    int h = n / 2;
+    size_t h2 = (size_t)h * h;
+    MatView A11 = A.quad(0, 0, h), A12 = A.quad(0, 1, h), A21 = A.quad(1, 0, h), A22 = A.quad(1, 1, h);
+    MatView B11 = B.quad(0, 0, h), B12 = B.quad(0, 1, h), B21 = B.quad(1, 0, h), B22 = B.quad(1, 1, h);
+    MatView C11 = C.quad(0, 0, h), C12 = C.quad(0, 1, h), C21 = C.quad(1, 0, h), C22 = C.quad(1, 1, h);
+
+    if (depth < taskDepth) {
+        // Parallel level: all S/T sums up front, then the 7 products as tasks
+        MatView S1 = {ws, h}, S2 = {ws + h2, h}, S3 = {ws + 2 * h2, h}, S4 = {ws + 3 * h2, h};
+        MatView T1 = {ws + 4 * h2, h}, T2 = {ws + 5 * h2, h}, T3 = {ws + 6 * h2, h}, T4 = {ws + 7 * h2, h};
+        MatView P1 = {ws + 8 * h2, h}, P6 = {ws + 9 * h2, h}, P7 = {ws + 10 * h2, h};
+        double* child = ws + 11 * h2;
+        size_t childSize = strassenWorkspace(h, cutoff, depth + 1, taskDepth);
+
+        addBlocks(h, A21, A22, S1, 1.0, true);
+        addBlocks(h, S1, A11, S2, -1.0, true);
+        addBlocks(h, A11, A21, S3, -1.0, true);
+        addBlocks(h, A12, S2, S4, -1.0, true);
+        addBlocks(h, B12, B11, T1, -1.0, true);
+        addBlocks(h, B22, T1, T2, -1.0, true);
+        addBlocks(h, B22, B12, T3, -1.0, true);
+        addBlocks(h, T2, B21, T4, -1.0, true);
+
+        #pragma omp task
+        strassenRec(h, A11, B11, P1, child, cutoff, depth + 1, taskDepth);
+        #pragma omp task
+        strassenRec(h, A12, B21, C11, child + childSize, cutoff, depth + 1, taskDepth);     // P2
+        #pragma omp task
+        strassenRec(h, S4, B22, C12, child + 2 * childSize, cutoff, depth + 1, taskDepth);  // P3
+        #pragma omp task
+        strassenRec(h, A22, T4, C21, child + 3 * childSize, cutoff, depth + 1, taskDepth);  // P4
+        #pragma omp task
+        strassenRec(h, S1, T1, C22, child + 4 * childSize, cutoff, depth + 1, taskDepth);   // P5
+        #pragma omp task
+        strassenRec(h, S2, T2, P6, child + 5 * childSize, cutoff, depth + 1, taskDepth);
+        #pragma omp task
+        strassenRec(h, S3, T3, P7, child + 6 * childSize, cutoff, depth + 1, taskDepth);
+        #pragma omp taskwait
+
+        // C11 = P1 + P2, C12 = U2 + P5 + P3, C21 = U3 - P4, C22 = U3 + P5
+        // with U2 = P1 + P6 and U3 = U2 + P7, all in one pass
+        #pragma omp taskloop grainsize(32)
+        for (int i = 0; i < h; ++i) {
+            const double *p1 = P1.row(i), *p6 = P6.row(i), *p7 = P7.row(i);
+            double *c11 = C11.row(i), *c12 = C12.row(i), *c21 = C21.row(i), *c22 = C22.row(i);
+            for (int j = 0; j < h; ++j) {
+                double u2 = p1[j] + p6[j];
+                double u3 = u2 + p7[j];
+                double p5 = c22[j];
+                c11[j] += p1[j];
+                c12[j] += u2 + p5;
+                c21[j] = u3 - c21[j];
+                c22[j] = u3 + p5;
+            }
+        }
+        return;
+    }
+
+    // Sequential level: two scratch blocks X and Y, products go into C's quadrants
+    MatView X = {ws, h}, Y = {ws + h2, h};
+    double* child = ws + 2 * h2;
+    addBlocks(h, A11, A21, X, -1.0, false);                           // S3
+    addBlocks(h, B22, B12, Y, -1.0, false);                           // T3
+    strassenRec(h, X, Y, C21, child, cutoff, depth + 1, taskDepth);   // P7
+    addBlocks(h, A21, A22, X, 1.0, false);                            // S1
+    addBlocks(h, B12, B11, Y, -1.0, false);                           // T1
+    strassenRec(h, X, Y, C22, child, cutoff, depth + 1, taskDepth);   // P5
+    addBlocks(h, X, A11, X, -1.0, false);                             // S2 = S1 - A11
+    addBlocks(h, B22, Y, Y, -1.0, false);                             // T2 = B22 - T1
+    strassenRec(h, X, Y, C12, child, cutoff, depth + 1, taskDepth);   // P6
+    addBlocks(h, A12, X, X, -1.0, false);                             // S4 = A12 - S2
+    strassenRec(h, X, B22, C11, child, cutoff, depth + 1, taskDepth); // P3
+    strassenRec(h, A11, B11, X, child, cutoff, depth + 1, taskDepth); // P1
+    addBlocks(h, X, C12, C12, 1.0, false);                            // U2 = P1 + P6
+    addBlocks(h, C12, C21, C21, 1.0, false);                          // U3 = U2 + P7
+    addBlocks(h, C12, C22, C12, 1.0, false);                          // U4 = U2 + P5
+    addBlocks(h, C21, C22, C22, 1.0, false);                          // U7 = U3 + P5 -> C22
+    addBlocks(h, C12, C11, C12, 1.0, false);                          // U5 = U4 + P3 -> C12
+    addBlocks(h, Y, B21, Y, -1.0, false);                             // T4 = T2 - B21
+    strassenRec(h, A22, Y, C11, child, cutoff, depth + 1, taskDepth); // P4
+    addBlocks(h, C21, C11, C21, -1.0, false);                         // U6 = U3 - P4 -> C21
+    strassenRec(h, A12, B21, C11, child, cutoff, depth + 1, taskDepth); // P2
+    addBlocks(h, X, C11, C11, 1.0, false);                            // U1 = P1 + P2 -> C11
+}
+
+// C = A * B for row-major N x N arrays. Returns the time in seconds.
+double strassenMatMul(int N, double* A, double* B, double* C, int cutoff) {
+    double start_time = omp_get_wtime();
+    if (strassenLeaf(N, cutoff)) {
+        gemm(N, N, N, A, N, B, N, C, N, 0.0);
+        return omp_get_wtime() - start_time;
+    }
+    // One task level gives 7 products; two give 49 when there are more than 7 threads
+    int threads = omp_get_max_threads();
+    int taskDepth = (threads == 1) ? 0 : (threads <= 7 ? 1 : 2);
+    AlignedVector arena(strassenWorkspace(N, cutoff, 0, taskDepth));
+
+    #pragma omp parallel
+    #pragma omp single
+    strassenRec(N, {A, N}, {B, N}, {C, N}, arena.data(), cutoff, 0, taskDepth);
+
+    return omp_get_wtime() - start_time;
+}
+
+// Strassen vs blocked GEMM at one size, for several cutoffs
+void strassenDemo(int N) {
+    AlignedVector A((size_t)N * N), B((size_t)N * N), C_ref((size_t)N * N), C((size_t)N * N);
+    for (size_t i = 0; i < A.size(); ++i) {
+        A[i] = (rand() % 100) / 10.0;
+        B[i] = (rand() % 100) / 10.0;
+    }
+    double start_time = omp_get_wtime();
+    gemm(N, N, N, A.data(), N, B.data(), N, C_ref.data(), N, 0.0);
+    double gemm_time = omp_get_wtime() - start_time;
+    double ref_max = 0.0;
+    for (double v : C_ref) {
+        ref_max = max(ref_max, fabs(v));
+    }
+
+    cout << "\n--- Strassen-Winograd vs Blocked GEMM (N = " << N << ") ---" << endl;
+    cout << setw(12) << "Cutoff" << setw(20) << "Time (s)" << setw(12) << "Speedup" << setw(20) << "Rel. Max Error" << endl;
+    cout << setw(12) << "gemm" << setw(20) << gemm_time << setw(12) << setprecision(2) << 1.0
+         << setw(20) << scientific << 0.0 << fixed << setprecision(8) << endl;
+    for (int cutoff : {1024, 512, 256, 128}) {
+        if (cutoff >= N) {
+            continue;
+        }
+        double t = strassenMatMul(N, A.data(), B.data(), C.data(), cutoff);
+        double err = 0.0;
+        for (size_t i = 0; i < C.size(); ++i) {
+            err = max(err, fabs(C[i] - C_ref[i]));
+        }
+        cout << setw(12) << cutoff << setw(20) << t << setw(12) << setprecision(2) << gemm_time / t
+             << setw(20) << scientific << err / ref_max << fixed << setprecision(8) << endl;
+    }
+}
+
+// Largest absolute difference between two results
+double maxDiff(const Matrix& X, const Matrix& Y, int N) {
+    double worst = 0.0;
+    for (int i = 0; i < N; ++i) {
+        for (int j = 0; j < N; ++j) {
+            worst = max(worst, fabs(X[i][j] - Y[i][j]));
+        }
+    }
+    return worst;
+}
+
 int main() {
     srand(time(NULL)); // Seed random number generator
     cout << fixed << setprecision(8);
 
     vector<int> dimensions = {3, 10, 100, 1000};
     
+    const char* kernelName;
+    gemmSelectKernel(&kernelName);
+    numaBindThreads();
+    int policy = numaPolicy();
     cout << "--- Matrix Multiplication (Question 4) ---" << endl;
+    numaReport();
+    cout << "Blocked GEMM micro-kernel: " << kernelName << ", threads: " << omp_get_max_threads() << endl;
     cout << setw(12) << "Dimension (N)"
          << setw(20) << "Serial Time (s)"
-         << setw(20) << "Parallel Time (s)" << endl;
-    cout << "---------------------------------------------------------" << endl;
+         << setw(20) << "Parallel Time (s)"
+         << setw(20) << "Packed Time (s)"
+         << setw(20) << "Blocked Time (s)"
+         << setw(16) << "Max Diff" << endl;
+    cout << "-----------------------------------------------------------------------------------------------------------" << endl;
 
     for (int N : dimensions) {
-        // Allocate matrices
-        Matrix A(N, vector<double>(N));
-        Matrix B(N, vector<double>(N));
+        // Allocate matrices. The ones the parallel multiply works on get their rows
+        // placed on the node of the thread that uses them (see numa_util.h).
+        Matrix A = numaMatrix<double>(N, N, policy);
+        Matrix B = numaMatrix<double>(N, N, policy);
         Matrix C_serial(N, vector<double>(N));
-        Matrix C_parallel(N, vector<double>(N));
+        Matrix C_parallel = numaMatrix<double>(N, N, policy);
+        Matrix C_packed(N, vector<double>(N));
+        Matrix C_blocked(N, vector<double>(N));
 
         // Initialize A and B
         initMatrix(A, N);
@@ -92,19 +435,26 @@ int main() {
 
         double serial_time = serialMatMul(A, B, C_serial, N);
         double parallel_time = parallelMatMul(A, B, C_parallel, N);
+        double packed_time = packedMatMul(A, B, C_packed, N);
+        double blocked_time = blockedMatMul(A, B, C_blocked, N);
 
         cout << setw(12) << N
              << setw(20) << serial_time
-             << setw(20) << parallel_time << endl;
+             << setw(20) << parallel_time
+             << setw(20) << packed_time
+             << setw(20) << blocked_time
+             << setw(16) << max(maxDiff(C_serial, C_packed, N), maxDiff(C_serial, C_blocked, N)) << endl;
              
         if (N == 3) {
             cout << "\nN=3 Serial Result:" << endl;
             printMatrix(C_serial, N);
             cout << "\nN=3 Parallel Result:" << endl;
             printMatrix(C_parallel, N);
-            cout << "\n---------------------------------------------------------" << endl;
+            cout << "\n-----------------------------------------------------------------------------------------------------------" << endl;
         }
     }
 
+    strassenDemo(2048);
+
     return 0;
 }
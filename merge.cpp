@@ -5,6 +5,8 @@
 #include <cstdlib> // For rand
 #include <ctime>   // For time
 #include <algorithm> // For copy
+#include <cstdint>   // For uintptr_t
+#include <type_traits> // For make_unsigned, is_signed
 
 using namespace std;
 
@@ -82,10 +84,82 @@ void serialMergeSort(vector<int>& arr, int l, int r) {
     merge(arr, l, m, r);
 }
 
+// --- Parallel merge (merge path) ---
+// merge() is serial, so the final merge of all N elements runs on one core no matter
+// how many threads sorted the halves. Instead, the output [0, n) is cut into equal
+// chunks; for a chunk starting at output index k, coRank() finds by binary search how
+// many of the first k outputs come from the left half (i) and from the right (k - i).
+// Every chunk is then an ordinary serial merge of two independent input ranges.
+
+// Number of elements of A[0..n1) among the first k outputs of the stable merge of A and
+// B (ties are taken from A, as in merge())
+int coRank(int k, const int* A, int n1, const int* B, int n2) {
+    int lo = max(0, k - n2);
+    int hi = min(k, n1);
+    while (lo < hi) {
+        int i = lo + (hi - lo) / 2;
+        int j = k - i;
+        if (A[i] <= B[j - 1]) {
+            lo = i + 1; // A[i] is output before B[j - 1]: more than i elements come from A
+        } else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+// Merge the chunk [k0, k1) of the output of L[0..n1) and R[0..n2) into out[k0..k1)
+void mergeChunk(const int* L, int n1, const int* R, int n2, int* out, int k0, int k1) {
+    int i = coRank(k0, L, n1, R, n2), iEnd = coRank(k1, L, n1, R, n2);
+    int j = k0 - i, jEnd = k1 - iEnd;
+    int k = k0;
+    while (i < iEnd && j < jEnd) {
+        out[k++] = (L[i] <= R[j]) ? L[i++] : R[j++];
+    }
+    while (i < iEnd) {
+        out[k++] = L[i++];
+    }
+    while (j < jEnd) {
+        out[k++] = R[j++];
+    }
+}
+
+// Merge L[0..n1) and R[0..n2) into out in `parts` independent chunks (taskloop, so it
+// is called from inside a task like the rest of the sorts). out must not overlap L or R.
+void mergePath(const int* L, int n1, const int* R, int n2, int* out, int parts) {
+    int n = n1 + n2;
+    #pragma omp taskloop
+    for (int p = 0; p < parts; ++p) {
+        mergeChunk(L, n1, R, n2, out, (int)((long long)n * p / parts), (int)((long long)n * (p + 1) / parts));
+    }
+}
+
+// Merge arr[l..m] and arr[m+1..r] with mergePath() via a temporary copy
+void parallelMerge(vector<int>& arr, int l, int m, int r, int parts) {
+    int n1 = m - l + 1;
+    int n = r - l + 1;
+    vector<int> tmp(n);
+
+    #pragma omp taskloop shared(arr, tmp)
+    for (int p = 0; p < parts; ++p) {
+        int begin = (int)((long long)n * p / parts);
+        int end = (int)((long long)n * (p + 1) / parts);
+        copy(arr.begin() + l + begin, arr.begin() + l + end, tmp.begin() + begin);
+    }
+    mergePath(tmp.data(), n1, tmp.data() + n1, n - n1, arr.data() + l, parts);
+}
+
+// Merge-path chunks for a merge at recursion depth `depth`: the threads left over
+// once the 2^depth merges of that level each have one. Values <= 1 mean serial.
+int mergeParts(int depth) {
+    return (depth < 30) ? (omp_get_num_threads() >> depth) : 0;
+}
+
 // 4. b) Parallel Merge Sort (using OpenMP tasks)
-// 
-// 
-void parallelMergeSort(vector<int>& arr, int l, int r) {
+// The recursion runs as tasks. At depth d there are 2^d merges running at once, so
+// while that is fewer than the number of threads each merge is itself split into
+// (threads / 2^d) merge-path chunks; deeper merges stay serial.
+void parallelMergeSort(vector<int>& arr, int l, int r, int depth = 0) {
     if (l >= r) {
         return; // Base case
     }
@@ -99,16 +173,212 @@ void parallelMergeSort(vector<int>& arr, int l, int r) {
     } else {
         int m = l + (r - l) / 2;
         
-        // Create two parallel tasks for the recursive calls
-        #pragma omp task
-        parallelMergeSort(arr, l, m);
+        // Create two parallel tasks for the recursive calls (on arr itself, not a copy)
+        #pragma omp task shared(arr)
+        parallelMergeSort(arr, l, m, depth + 1);
         
-        #pragma omp task
-        parallelMergeSort(arr, m + 1, r);
+        #pragma omp task shared(arr)
+        parallelMergeSort(arr, m + 1, r, depth + 1);
         
         // Wait for both tasks to complete before merging
         #pragma omp taskwait
-        merge(arr, l, m, r);
+        int parts = mergeParts(depth);
+        if (parts > 1) {
+            parallelMerge(arr, l, m, r, parts);
+        } else {
+            merge(arr, l, m, r);
+        }
+    }
+}
+
+// 4. c) Ping-pong Merge Sort (one auxiliary buffer)
+// merge() allocates two temporary vectors on every call: about N allocations per sort,
+// and under tasks every thread queues on the allocator. Here one buffer of N elements
+// is allocated up front and the two arrays swap roles at every level: a call sorts
+// src[l..r) into dst[l..r) by sorting both halves from dst into src (the roles are
+// exchanged) and then merging them from src back into dst. No data is copied between
+// levels and no merge allocates.
+//
+// On entry both arrays hold the same elements in [l, r): they start as copies and
+// every range is written only by its own call and its descendants, which run first.
+
+const int INSERTION_CUTOFF = 24; // Leaves are sorted in place by insertion sort
+
+void insertionSort(int* a, int l, int r) {
+    for (int i = l + 1; i < r; ++i) {
+        int v = a[i];
+        int j = i - 1;
+        while (j >= l && a[j] > v) {
+            a[j + 1] = a[j];
+            j--;
+        }
+        a[j + 1] = v;
+    }
+}
+
+// Sorts the elements of [l, r) into dst. Recursion and merges are parallelized like
+// parallelMergeSort: tasks above the cutoff, merge-path merges at the top levels.
+void pingPongSort(int* src, int* dst, int l, int r, int depth) {
+    int n = r - l;
+    if (n <= INSERTION_CUTOFF) {
+        insertionSort(dst, l, r);
+        return;
+    }
+    int m = l + n / 2;
+    if (n < 1000) {
+        pingPongSort(dst, src, l, m, depth + 1);
+        pingPongSort(dst, src, m, r, depth + 1);
+    } else {
+        #pragma omp task
+        pingPongSort(dst, src, l, m, depth + 1);
+        #pragma omp task
+        pingPongSort(dst, src, m, r, depth + 1);
+        #pragma omp taskwait
+    }
+    int parts = (n >= 1000) ? mergeParts(depth) : 0;
+    if (parts > 1) {
+        mergePath(src + l, m - l, src + m, r - m, dst + l, parts);
+    } else {
+        mergeChunk(src + l, m - l, src + m, r - m, dst + l, 0, n);
+    }
+}
+
+void pingPongMergeSort(vector<int>& arr) {
+    int n = arr.size();
+    vector<int> aux(arr); // The only allocation of the sort
+    #pragma omp parallel
+    {
+        #pragma omp single
+        pingPongSort(aux.data(), arr.data(), 0, n, 0);
+    }
+}
+
+// 4. d) Parallel LSD Radix Sort
+// The keys are plain integers, so no comparisons are needed: stable counting passes
+// over 8-bit digits, least significant first (4 passes for 32-bit keys, 8 for 64-bit).
+// Each pass:
+//   1. every thread counts the digits of its own contiguous block (private histogram)
+//   2. one thread turns the histograms into start offsets: digit-major, then thread,
+//      so thread t writes its d-digit keys right after those of threads 0..t-1
+//   3. every thread scatters its block to the other buffer, in the same order (stable)
+// Passes in which every key has the same digit are skipped; for initArray's keys
+// (0..9999) only the low two digits are ever sorted.
+//
+// A direct scatter writes to 256 different places in turn, and each write touches a
+// different cache line (and page). Keys are staged instead in a small per-thread
+// write-combining buffer per digit and written out one whole cache line at a time:
+// the first flush of every digit only goes up to the next 64-byte boundary of the
+// output, so every later flush covers exactly one aligned line. Histograms are padded
+// to whole cache lines and threads write into disjoint output ranges, so the only
+// lines two threads share are the few at range boundaries.
+
+const int RADIX_BITS = 8;
+const int RADIX = 1 << RADIX_BITS;
+const int RADIX_LINE = 64;            // Bytes per cache line (one write-combining flush)
+const int RADIX_SMALL_N = 1 << 12;    // Below this std::sort beats the counting passes
+const int RADIX_PER_THREAD = 1 << 15; // Minimum keys per thread
+
+struct alignas(64) RadixCounts {
+    int c[RADIX];
+};
+
+// Digit of x at `shift`; for signed keys the sign bit is flipped so negatives sort first
+template <typename Key>
+inline int radixDigit(Key x, int shift) {
+    typedef typename make_unsigned<Key>::type U;
+    const U flip = is_signed<Key>::value ? (U)1 << (8 * sizeof(Key) - 1) : 0;
+    return (int)((((U)x ^ flip) >> shift) & (RADIX - 1));
+}
+
+// Keys between dst and the next cache-line boundary (a full line if already aligned)
+template <typename Key>
+inline int radixToLine(const Key* dst) {
+    const int keys = RADIX_LINE / sizeof(Key);
+    int offset = (int)(((uintptr_t)dst % RADIX_LINE) / sizeof(Key));
+    return keys - offset;
+}
+
+template <typename Key>
+void radixSort(vector<Key>& arr) {
+    const int WC = RADIX_LINE / sizeof(Key); // Keys per write-combining buffer
+    int n = arr.size();
+    if (n < RADIX_SMALL_N) {
+        sort(arr.begin(), arr.end());
+        return;
+    }
+    int threads = min(omp_get_max_threads(), max(1, n / RADIX_PER_THREAD));
+    vector<Key> aux(n);
+    vector<RadixCounts> counts(threads);
+    bool skip = false;
+    int passes = 0; // Passes actually performed (the result is in aux when odd)
+
+    #pragma omp parallel num_threads(threads)
+    {
+        int t = omp_get_thread_num();
+        int T = omp_get_num_threads();
+        int begin = (int)((long long)n * t / T);
+        int end = (int)((long long)n * (t + 1) / T);
+        const Key* src = arr.data();
+        Key* dst = aux.data();
+        alignas(64) Key wc[RADIX][RADIX_LINE / sizeof(Key)];
+        int fill[RADIX];
+        int limit[RADIX]; // Keys to collect before the next flush of each digit
+
+        for (int shift = 0; shift < 8 * (int)sizeof(Key); shift += RADIX_BITS) {
+            int* c = counts[t].c;
+            fill_n(c, RADIX, 0);
+            for (int i = begin; i < end; ++i) {
+                c[radixDigit(src[i], shift)]++;
+            }
+            #pragma omp barrier
+
+            #pragma omp single
+            {
+                int sum = 0;
+                skip = false;
+                for (int d = 0; d < RADIX; ++d) {
+                    int digitStart = sum;
+                    for (int u = 0; u < T; ++u) {
+                        int count = counts[u].c[d];
+                        counts[u].c[d] = sum;
+                        sum += count;
+                    }
+                    skip = skip || (sum - digitStart == n);
+                }
+                if (!skip) {
+                    passes++;
+                }
+            } // Implicit barrier: offsets and skip are visible to all threads
+
+            if (skip) {
+                continue;
+            }
+            for (int d = 0; d < RADIX; ++d) {
+                fill[d] = 0;
+                limit[d] = radixToLine(dst + c[d]);
+            }
+            for (int i = begin; i < end; ++i) {
+                Key v = src[i];
+                int d = radixDigit(v, shift);
+                wc[d][fill[d]++] = v;
+                if (fill[d] == limit[d]) {
+                    copy(wc[d], wc[d] + fill[d], dst + c[d]);
+                    c[d] += fill[d];
+                    fill[d] = 0;
+                    limit[d] = WC; // dst + c[d] is now line aligned
+                }
+            }
+            for (int d = 0; d < RADIX; ++d) {
+                copy(wc[d], wc[d] + fill[d], dst + c[d]);
+            }
+            #pragma omp barrier // The pass is complete before anyone reads dst
+            Key* next = const_cast<Key*>(src);
+            src = dst;
+            dst = next;
+        }
+    }
+    if (passes % 2 == 1) {
+        arr.swap(aux);
     }
 }
 
@@ -121,14 +391,21 @@ int main() {
     cout << "--- Merge Sort (Question 4) ---" << endl;
     cout << setw(12) << "Elements (N)"
          << setw(20) << "Serial Time (s)"
-         << setw(20) << "Parallel Time (s)" << endl;
-    cout << "---------------------------------------------------------" << endl;
+         << setw(20) << "Parallel Time (s)"
+         << setw(20) << "Ping-pong Time (s)"
+         << setw(20) << "Radix Time (s)"
+         << setw(20) << "std::sort Time (s)"
+         << setw(10) << "Sorted" << endl;
+    cout << "-------------------------------------------------------------------------------------------------------------------------------" << endl;
 
     for (int N : sizes) {
         vector<int> arr_s(N);
         initArray(arr_s, N);
         // Make a copy for the parallel version
         vector<int> arr_p = arr_s;
+        vector<int> arr_pp = arr_s;
+        vector<int> arr_r = arr_s;
+        vector<int> arr_q = arr_s;
         
         // Time Serial
         double start_s = omp_get_wtime();
@@ -146,18 +423,61 @@ int main() {
         }
         double end_p = omp_get_wtime();
 
+        // Time Ping-pong (parallel, single auxiliary buffer)
+        double start_pp = omp_get_wtime();
+        pingPongMergeSort(arr_pp);
+        double end_pp = omp_get_wtime();
+
+        // Time Radix (parallel LSD, no comparisons)
+        double start_r = omp_get_wtime();
+        radixSort(arr_r);
+        double end_r = omp_get_wtime();
+
+        // Time std::sort: the comparison-sort reference for the radix column. It is
+        // an introsort like quick.cpp's introsort_parallel; quick.cpp's own sorts are
+        // timed on the same kind of input by that program (one program per file here)
+        double start_q = omp_get_wtime();
+        sort(arr_q.begin(), arr_q.end());
+        double end_q = omp_get_wtime();
+
         cout << setw(12) << N
              << setw(20) << (end_s - start_s)
-             << setw(20) << (end_p - start_p) << endl;
+             << setw(20) << (end_p - start_p)
+             << setw(20) << (end_pp - start_pp)
+             << setw(20) << (end_r - start_r)
+             << setw(20) << (end_q - start_q)
+             << setw(10) << (arr_p == arr_s && arr_pp == arr_s && arr_r == arr_s && arr_q == arr_s ? "yes" : "NO") << endl;
              
         if (N == 10) {
             cout << "\nN=10 Serial Sorted:" << endl;
             printArray(arr_s);
             cout << "N=10 Parallel Sorted:" << endl;
             printArray(arr_p);
-            cout << "\n---------------------------------------------------------" << endl;
+            cout << "N=10 Ping-pong Sorted:" << endl;
+            printArray(arr_pp);
+            cout << "N=10 Radix Sorted:" << endl;
+            printArray(arr_r);
+            cout << "\n-------------------------------------------------------------------------------------------------------------------------------" << endl;
         }
     }
 
+    // 64-bit keys over the whole signed range: all eight digit passes are needed
+    int N64 = 1000000;
+    vector<long long> keys64(N64);
+    for (long long& k : keys64) {
+        // Built unsigned (bit 63 comes from rand()'s top bit), then cast once
+        unsigned long long u = ((unsigned long long)rand() << 33) ^ ((unsigned long long)rand() << 2)
+                               ^ (unsigned long long)rand();
+        k = (long long)u;
+    }
+    vector<long long> ref64 = keys64;
+    double start_64 = omp_get_wtime();
+    radixSort(keys64);
+    double end_64 = omp_get_wtime();
+    sort(ref64.begin(), ref64.end());
+    double end_ref64 = omp_get_wtime();
+    cout << "\n64-bit keys, N=" << N64 << ": radix " << (end_64 - start_64) << " s, std::sort "
+         << (end_ref64 - end_64) << " s, sorted: " << (keys64 == ref64 ? "yes" : "NO") << endl;
+
     return 0;
 }
@@ -0,0 +1,228 @@
+// NUMA placement helpers for the dense drivers (matrix.cpp, floyd.cpp, gauss.cpp)
+//
+// Linux places a page on the node of the thread that first writes it. A matrix that
+// is filled by one thread therefore lives entirely on that thread's socket, and every
+// thread on the other socket then reads it over the interconnect while one memory
+// controller does all the work. Two fixes:
+//
+//   first touch (default): each row is allocated and zeroed by the thread that owns it
+//                          in a schedule(static) row loop, i.e. the same thread that
+//                          later works on it in the compute loops
+//   interleave:            rows are dealt round-robin to threads (row granularity), and
+//                          flat buffers are spread page by page with mbind(), so data
+//                          read by every thread (B in C = A * B) loads all controllers
+//
+// Choose with NUMA_POLICY=first-touch|interleave. Placement only sticks if threads stay
+// put: set OMP_PROC_BIND / OMP_PLACES (e.g. OMP_PROC_BIND=spread OMP_PLACES=cores),
+// otherwise numaBindThreads() pins thread t explicitly, spreading threads over nodes.
+// numaReport() prints the setup and a STREAM-triad bandwidth for every node.
+
+#ifndef NUMA_UTIL_H
+#define NUMA_UTIL_H
+
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <omp.h>
+#include <sched.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/syscall.h>
+
+const int NUMA_FIRST_TOUCH = 0;
+const int NUMA_INTERLEAVE = 1;
+
+// Policy from the NUMA_POLICY environment variable
+inline int numaPolicy() {
+    const char* p = getenv("NUMA_POLICY");
+    return (p != nullptr && strcmp(p, "interleave") == 0) ? NUMA_INTERLEAVE : NUMA_FIRST_TOUCH;
+}
+
+// Number of NUMA nodes (1 when sysfs has no node information)
+inline int numaNodeCount() {
+    static int count = 0;
+    if (count == 0) {
+        DIR* dir = opendir("/sys/devices/system/node");
+        if (dir != nullptr) {
+            while (dirent* e = readdir(dir)) {
+                if (strncmp(e->d_name, "node", 4) == 0 && e->d_name[4] >= '0' && e->d_name[4] <= '9') {
+                    count = std::max(count, atoi(e->d_name + 4) + 1);
+                }
+            }
+            closedir(dir);
+        }
+        count = std::max(count, 1);
+    }
+    return count;
+}
+
+// Node of a CPU: sysfs lists a "nodeN" entry in each CPU's directory
+inline int numaNodeOfCpu(int cpu) {
+    char path[64];
+    for (int n = 0; n < numaNodeCount(); ++n) {
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/node%d", cpu, n);
+        if (access(path, F_OK) == 0) {
+            return n;
+        }
+    }
+    return 0;
+}
+
+// Pin OpenMP thread t when the runtime was not told how to bind: allowed CPUs are
+// grouped by node and threads are dealt round-robin over the nodes (spread)
+inline void numaBindThreads() {
+    if (getenv("OMP_PROC_BIND") != nullptr || getenv("OMP_PLACES") != nullptr) {
+        return; // The runtime binds
+    }
+    cpu_set_t allowed;
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+        return;
+    }
+    std::vector<std::vector<int>> cpusOfNode(numaNodeCount());
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &allowed)) {
+            cpusOfNode[numaNodeOfCpu(cpu)].push_back(cpu);
+        }
+    }
+    std::vector<int> nodes;
+    for (int n = 0; n < (int)cpusOfNode.size(); ++n) {
+        if (!cpusOfNode[n].empty()) {
+            nodes.push_back(n);
+        }
+    }
+    if (nodes.empty()) {
+        return;
+    }
+    #pragma omp parallel
+    {
+        int t = omp_get_thread_num();
+        const std::vector<int>& cpus = cpusOfNode[nodes[t % nodes.size()]];
+        cpu_set_t one;
+        CPU_ZERO(&one);
+        CPU_SET(cpus[(t / nodes.size()) % cpus.size()], &one);
+        sched_setaffinity(0, sizeof(one), &one);
+    }
+}
+
+// Interleave the pages of [p, p + bytes) over all nodes with mbind(MPOL_INTERLEAVE).
+// Must run before the pages are first touched; partial pages at the ends keep the
+// default policy. A no-op on single-node machines.
+inline void numaInterleave(void* p, size_t bytes) {
+    int nodes = numaNodeCount();
+    if (nodes < 2 || nodes > 64) {
+        return;
+    }
+    const int MPOL_INTERLEAVE_MODE = 3; // MPOL_INTERLEAVE from <numaif.h>
+    size_t page = sysconf(_SC_PAGESIZE);
+    size_t begin = ((size_t)p + page - 1) / page * page;
+    size_t end = ((size_t)p + bytes) / page * page;
+    if (end <= begin) {
+        return;
+    }
+    unsigned long mask = (nodes == 64) ? ~0UL : (1UL << nodes) - 1;
+    syscall(SYS_mbind, (void*)begin, end - begin, MPOL_INTERLEAVE_MODE, &mask, (unsigned long)nodes + 1, 0);
+}
+
+// rows x cols matrix of T() whose rows are first touched according to the policy
+template <typename T>
+std::vector<std::vector<T>> numaMatrix(int rows, int cols, int policy) {
+    std::vector<std::vector<T>> M(rows);
+    if (policy == NUMA_INTERLEAVE) {
+        #pragma omp parallel for schedule(static, 1)
+        for (int i = 0; i < rows; ++i) {
+            M[i].assign(cols, T());
+        }
+    } else {
+        #pragma omp parallel for schedule(static)
+        for (int i = 0; i < rows; ++i) {
+            M[i].assign(cols, T());
+        }
+    }
+    return M;
+}
+
+// Copy of a matrix, placed like numaMatrix() (plain copy construction would put
+// every row on the node of the copying thread)
+template <typename T>
+std::vector<std::vector<T>> numaCopy(const std::vector<std::vector<T>>& src, int policy) {
+    int rows = src.size();
+    std::vector<std::vector<T>> M(rows);
+    if (policy == NUMA_INTERLEAVE) {
+        #pragma omp parallel for schedule(static, 1)
+        for (int i = 0; i < rows; ++i) {
+            M[i] = src[i];
+        }
+    } else {
+        #pragma omp parallel for schedule(static)
+        for (int i = 0; i < rows; ++i) {
+            M[i] = src[i];
+        }
+    }
+    return M;
+}
+
+static volatile double numaSink;
+
+// Nodes, policy, binding, and the triad bandwidth (a = b + s * c) each node sustains
+// when all threads run at once on their own first-touched arrays
+inline void numaReport() {
+    int nodes = numaNodeCount();
+    int threads = omp_get_max_threads();
+    const char* bind = getenv("OMP_PROC_BIND");
+    const char* places = getenv("OMP_PLACES");
+    std::cout << "NUMA: " << nodes << " node(s), policy "
+              << (numaPolicy() == NUMA_INTERLEAVE ? "interleave" : "first-touch") << ", binding ";
+    if (bind != nullptr || places != nullptr) {
+        std::cout << "OMP_PROC_BIND=" << (bind ? bind : "-") << " OMP_PLACES=" << (places ? places : "-");
+    } else {
+        std::cout << "explicit (spread over nodes)";
+    }
+    std::cout << ", " << threads << " threads" << std::endl;
+
+    const size_t total = (size_t)1 << 23; // Elements per array over all threads (64 MB)
+    const int reps = 5;
+    std::vector<double> nodeBytes(nodes, 0.0);
+    std::vector<int> nodeThreads(nodes, 0);
+    double elapsed = 0.0;
+    #pragma omp parallel
+    {
+        size_t n = total / omp_get_num_threads();
+        int node = numaNodeOfCpu(sched_getcpu());
+        std::vector<double> a(n), b(n, 1.0), c(n, 2.0); // First touch by this thread
+        #pragma omp barrier
+        double start = omp_get_wtime();
+        for (int r = 0; r < reps; ++r) {
+            for (size_t i = 0; i < n; ++i) {
+                a[i] = b[i] + 3.0 * c[i];
+            }
+        }
+        #pragma omp barrier
+        #pragma omp critical
+        {
+            nodeBytes[node] += 3.0 * sizeof(double) * n * reps;
+            numaSink = a[n / 2]; // Keeps the triad from being optimized away
+            nodeThreads[node]++;
+            elapsed = std::max(elapsed, omp_get_wtime() - start);
+        }
+    }
+    std::ios::fmtflags flags = std::cout.flags();
+    std::streamsize precision = std::cout.precision();
+    std::cout << std::fixed << std::setprecision(2);
+    double sum = 0.0;
+    for (int n = 0; n < nodes; ++n) {
+        if (nodeThreads[n] > 0) {
+            std::cout << "  node " << n << ": " << nodeThreads[n] << " threads, triad "
+                      << nodeBytes[n] / elapsed / 1e9 << " GB/s" << std::endl;
+            sum += nodeBytes[n];
+        }
+    }
+    std::cout << "  total: " << sum / elapsed / 1e9 << " GB/s" << std::endl;
+    std::cout.flags(flags);
+    std::cout.precision(precision);
+}
+
+#endif
@@ -0,0 +1,233 @@
+// Distributed Odd-Even Transposition Sort (MPI, block version with merge-split)
+//
+// Build: mpicxx -O2 oet_mpi.cpp -o oet_mpi
+// Run:   mpirun -np 4 ./oet_mpi              (default N = 2^22 keys)
+//        mpirun -np 8 ./oet_mpi 1000003      (any N; P = 2 .. 16 or more)
+//
+// The element-wise odd-even sort (oddmonte.cpp, pdc/lab-5/1.cpp, pdc/lab-6/oet.cpp)
+// compares neighbouring elements, N phases of N/2 compare-exchanges. Here every rank
+// owns a block of n = ceil(N/P) keys and the "elements" being compared are whole blocks:
+//   1. every rank sorts its block locally
+//   2. P phases: in even phases ranks (0,1), (2,3), ... are paired, in odd phases
+//      (1,2), (3,4), ...; partners swap blocks with MPI_Sendrecv and each merges the
+//      two sorted blocks, but only as far as it needs: the lower rank keeps the n
+//      smallest keys, the higher rank the n largest (merge-split)
+// After P phases the blocks are sorted across ranks (the merge-split network sorts
+// for the same reason the element-wise one does). If N does not divide by P, the
+// last blocks are padded with INT_MAX, which ends up at the very end and is dropped.
+//
+// Verification: every block must be sorted, the last key of each rank must not exceed
+// the first key of the next one, and the keys must be a permutation of the input (the
+// padding must be intact, and the sum and a hash sum of the keys are compared).
+// Finally the blocks are gathered on rank 0 and compared with std::sort of the same input.
+
+#include <iostream>
+#include <vector>
+#include <mpi.h>
+#include <iomanip>   // For setprecision, setw
+#include <cstdlib>   // For atoll
+#include <climits>   // For INT_MAX
+#include <algorithm> // For sort, is_sorted
+
+using namespace std;
+
+const int DEFAULT_N = 1 << 22;
+const int GATHER_MAX_N = 1 << 26; // Larger runs skip the gather on rank 0
+
+// Key g of the input. Every rank generates its own block, so no rank holds all of it.
+int inputKey(long long g) {
+    unsigned int h = (unsigned int)g * 2654435761u ^ (unsigned int)(g >> 32) * 40503u;
+    h ^= h >> 13;
+    h *= 1274126177u;
+    h ^= h >> 16;
+    return (int)(h % 100000000u); // 0 .. 10^8 - 1, with some duplicates
+}
+
+// Hash of a key for the permutation check: the sum of hashes is order independent
+unsigned long long keyHash(int x) {
+    unsigned long long h = (unsigned long long)(unsigned int)x * 0x9E3779B97F4A7C15ull;
+    return h ^ (h >> 29);
+}
+
+// Merge-split: mine and theirs are sorted blocks of n keys. Keeps the n smallest
+// (keepLow) or the n largest keys of both in out, sorted.
+void mergeSplit(const vector<int>& mine, const vector<int>& theirs, vector<int>& out, bool keepLow) {
+    int n = mine.size();
+    if (keepLow) {
+        int i = 0, j = 0;
+        for (int k = 0; k < n; ++k) {
+            out[k] = (mine[i] <= theirs[j]) ? mine[i++] : theirs[j++];
+        }
+    } else {
+        int i = n - 1, j = n - 1;
+        for (int k = n - 1; k >= 0; --k) {
+            out[k] = (mine[i] >= theirs[j]) ? mine[i--] : theirs[j--];
+        }
+    }
+}
+
+struct SortStats {
+    double sortTime;     // Local sort
+    double exchangeTime; // All P phases (communication + merge-split)
+    int exchanges;       // Phases in which this rank had a partner
+    int changed;         // ... and in which its block actually changed
+};
+
+// Sorts the distributed array; every rank holds `block` (n keys, the same n everywhere)
+SortStats oddEvenSort(vector<int>& block, int rank, int P) {
+    SortStats s = {0.0, 0.0, 0, 0};
+    int n = block.size();
+    vector<int> theirs(n), merged(n);
+
+    double t0 = MPI_Wtime();
+    sort(block.begin(), block.end());
+    double t1 = MPI_Wtime();
+
+    for (int phase = 0; phase < P; ++phase) {
+        // Even phase: 0-1, 2-3, ...; odd phase: 1-2, 3-4, ...
+        int partner = (phase % 2 == rank % 2) ? rank + 1 : rank - 1;
+        if (partner < 0 || partner >= P) {
+            continue; // Idle at the edge in this phase
+        }
+        MPI_Sendrecv(block.data(), n, MPI_INT, partner, phase,
+                     theirs.data(), n, MPI_INT, partner, phase,
+                     MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        s.exchanges++;
+        bool keepLow = rank < partner;
+        // Already in order across the pair: the merge would return the block unchanged
+        if (n > 0 && (keepLow ? block[n - 1] <= theirs[0] : theirs[n - 1] <= block[0])) {
+            continue;
+        }
+        mergeSplit(block, theirs, merged, keepLow);
+        block.swap(merged);
+        s.changed++;
+    }
+    double t2 = MPI_Wtime();
+
+    s.sortTime = t1 - t0;
+    s.exchangeTime = t2 - t1;
+    return s;
+}
+
+int main(int argc, char** argv) {
+    MPI_Init(&argc, &argv);
+    int rank, P;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &P);
+
+    long long N = (argc >= 2) ? atoll(argv[1]) : DEFAULT_N;
+    if (N < 1) {
+        if (rank == 0) {
+            cout << "Usage: mpirun -np P ./oet_mpi [N]" << endl;
+        }
+        MPI_Finalize();
+        return 1;
+    }
+    int n = (int)((N + P - 1) / P); // Keys per rank, the last ranks padded
+
+    // Generate this rank's block; keys past N are padding
+    vector<int> block(n);
+    long long first = (long long)rank * n;
+    unsigned long long sum = 0, hash = 0;
+    for (int i = 0; i < n; ++i) {
+        long long g = first + i;
+        if (g < N) {
+            block[i] = inputKey(g);
+            sum += block[i];
+            hash += keyHash(block[i]);
+        } else {
+            block[i] = INT_MAX;
+        }
+    }
+    unsigned long long before[2] = {sum, hash};
+    unsigned long long beforeAll[2];
+    MPI_Allreduce(before, beforeAll, 2, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    double start = MPI_Wtime();
+    SortStats s = oddEvenSort(block, rank, P);
+    MPI_Barrier(MPI_COMM_WORLD);
+    double total = MPI_Wtime() - start;
+
+    // --- Verification ---
+    // 1. Local order and 2. order across the rank boundaries
+    int ok = is_sorted(block.begin(), block.end()) ? 1 : 0;
+    int prevLast = INT_MIN;
+    int myLast = block[n - 1];
+    MPI_Sendrecv(&myLast, 1, MPI_INT, (rank + 1 < P) ? rank + 1 : MPI_PROC_NULL, 0,
+                 &prevLast, 1, MPI_INT, (rank > 0) ? rank - 1 : MPI_PROC_NULL, 0,
+                 MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    if (rank > 0 && prevLast > block[0]) {
+        ok = 0;
+    }
+    // 3. Same keys as before: the positions past N must still hold the padding, and the
+    // first N positions the input keys
+    sum = 0;
+    hash = 0;
+    for (int i = 0; i < n; ++i) {
+        if (first + i < N) {
+            sum += block[i];
+            hash += keyHash(block[i]);
+        } else if (block[i] != INT_MAX) {
+            ok = 0;
+        }
+    }
+    unsigned long long after[2] = {sum, hash};
+    unsigned long long afterAll[2];
+    MPI_Allreduce(after, afterAll, 2, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+    int allOk;
+    MPI_Allreduce(&ok, &allOk, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+    allOk = allOk && afterAll[0] == beforeAll[0] && afterAll[1] == beforeAll[1];
+
+    // Slowest rank per stage, and the number of exchanges over all pairs
+    double times[2] = {s.sortTime, s.exchangeTime};
+    double maxTimes[2];
+    MPI_Reduce(times, maxTimes, 2, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    int counts[2] = {s.exchanges, s.changed};
+    int sumCounts[2];
+    MPI_Reduce(counts, sumCounts, 2, MPI_INT, MPI_SUM, 0, MPI_COMM_WORLD);
+
+    // 4. Gather on rank 0 and compare with a serial sort of the same input
+    bool gathered = N <= GATHER_MAX_N;
+    int matches = -1;
+    double serialTime = 0.0;
+    if (gathered) {
+        vector<int> all;
+        if (rank == 0) {
+            all.resize((size_t)n * P);
+        }
+        MPI_Gather(block.data(), n, MPI_INT, all.data(), n, MPI_INT, 0, MPI_COMM_WORLD);
+        if (rank == 0) {
+            vector<int> ref(N);
+            for (long long g = 0; g < N; ++g) {
+                ref[g] = inputKey(g);
+            }
+            double t = MPI_Wtime();
+            sort(ref.begin(), ref.end());
+            serialTime = MPI_Wtime() - t;
+            matches = equal(ref.begin(), ref.end(), all.begin()) ? 1 : 0;
+        }
+    }
+
+    if (rank == 0) {
+        cout << "--- Odd-Even Transposition Sort (MPI) ---" << endl;
+        cout << "Ranks = " << P << ", N = " << N << ", keys per rank = " << n
+             << " (" << (long long)n * P - N << " padding)" << endl;
+        cout << fixed << setprecision(6);
+        cout << setw(28) << "Local sort (s): " << maxTimes[0] << endl;
+        cout << setw(28) << "Exchange phases (s): " << maxTimes[1] << endl;
+        cout << setw(28) << "Total (s): " << total << endl;
+        if (gathered) {
+            cout << setw(28) << "Serial std::sort (s): " << serialTime << endl;
+            cout << setw(28) << "Speedup: " << setprecision(2) << serialTime / total << endl;
+        }
+        cout << setw(28) << "Block exchanges: " << sumCounts[0] / 2 << " (" << sumCounts[1] / 2
+             << " of them moved keys)" << endl;
+        cout << setw(28) << "Distributed check: " << (allOk ? "sorted, same keys" : "FAILED") << endl;
+        cout << setw(28) << "Gathered vs std::sort: "
+             << (matches < 0 ? "skipped (N too large)" : (matches ? "match" : "MISMATCH")) << endl;
+    }
+
+    MPI_Finalize();
+    return (allOk && matches != 0) ? 0 : 1;
+}
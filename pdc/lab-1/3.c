@@ -1,34 +1,141 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <pthread.h>
+#include <time.h>
+#include <unistd.h>
 
 #define MAX 100 
 
 int A[MAX][MAX], B[MAX][MAX], C[MAX][MAX];
 int r1, c1, r2, c2;
 
+// Fixed pool of workers fed from a bounded queue: threads are created once
+// and reused, instead of one pthread_create/pthread_join per result row.
+#define QUEUE_CAP 64
+
 typedef struct {
-    int row;
-} ThreadData;
+    int row_begin, row_end;
+} RowBlock;
 
-void* multiply_row(void* arg) {
-    ThreadData* data = (ThreadData*)arg;
-    int row = data->row;
+typedef struct {
+    pthread_t* workers;
+    int num_workers;
+    RowBlock queue[QUEUE_CAP];
+    int head, tail, count, pending, shutdown;
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty, not_full, all_done;
+} ThreadPool;
+
+void multiply_rows(int row_begin, int row_end) {
+    for (int row = row_begin; row < row_end; row++) {
+        for (int j = 0; j < c2; j++) {
+            C[row][j] = 0;
+            for (int k = 0; k < c1; k++) {
+                C[row][j] += A[row][k] * B[k][j];
+            }
+        }
+    }
+}
 
-    for (int j = 0; j < c2; j++) {
-        C[row][j] = 0;
-        for (int k = 0; k < c1; k++) {
-            C[row][j] += A[row][k] * B[k][j];
+void* worker(void* arg) {
+    ThreadPool* pool = (ThreadPool*)arg;
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (pool->count == 0 && !pool->shutdown)
+            pthread_cond_wait(&pool->not_empty, &pool->lock);
+        if (pool->count == 0) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
         }
+        RowBlock block = pool->queue[pool->head];
+        pool->head = (pool->head + 1) % QUEUE_CAP;
+        pool->count--;
+        pthread_cond_signal(&pool->not_full);
+        pthread_mutex_unlock(&pool->lock);
+
+        multiply_rows(block.row_begin, block.row_end);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0)
+            pthread_cond_broadcast(&pool->all_done);
+        pthread_mutex_unlock(&pool->lock);
     }
+}
 
-    pthread_exit(NULL);
+// Same lifecycle as the pool in q1.c: returns 0 if at least one worker started
+int pool_init(ThreadPool* pool, int num_workers) {
+    pool->workers = malloc(num_workers * sizeof(pthread_t));
+    if (pool->workers == NULL)
+        return -1;
+    pool->num_workers = 0;
+    pool->head = pool->tail = pool->count = pool->pending = pool->shutdown = 0;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->not_empty, NULL);
+    pthread_cond_init(&pool->not_full, NULL);
+    pthread_cond_init(&pool->all_done, NULL);
+    for (int i = 0; i < num_workers; i++) {
+        // pthread_create returns the error code instead of setting errno
+        int rc = pthread_create(&pool->workers[i], NULL, worker, pool);
+        if (rc != 0) {
+            fprintf(stderr, "pthread_create: %s\n", strerror(rc));
+            break;
+        }
+        pool->num_workers++;
+    }
+    if (pool->num_workers == 0) {
+        // No worker started: release what was set up, pool_destroy will not be called
+        free(pool->workers);
+        pthread_mutex_destroy(&pool->lock);
+        pthread_cond_destroy(&pool->not_empty);
+        pthread_cond_destroy(&pool->not_full);
+        pthread_cond_destroy(&pool->all_done);
+        return -1;
+    }
+    return 0;
 }
 
-int main() {
-    pthread_t threads[MAX];
-    ThreadData threadData[MAX];
+void pool_submit(ThreadPool* pool, int row_begin, int row_end) {
+    pthread_mutex_lock(&pool->lock);
+    while (pool->count == QUEUE_CAP)
+        pthread_cond_wait(&pool->not_full, &pool->lock);
+    pool->queue[pool->tail].row_begin = row_begin;
+    pool->queue[pool->tail].row_end = row_end;
+    pool->tail = (pool->tail + 1) % QUEUE_CAP;
+    pool->count++;
+    pool->pending++;
+    pthread_cond_signal(&pool->not_empty);
+    pthread_mutex_unlock(&pool->lock);
+}
 
+void pool_wait(ThreadPool* pool) {
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending > 0)
+        pthread_cond_wait(&pool->all_done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void pool_destroy(ThreadPool* pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->not_empty);
+    pthread_mutex_unlock(&pool->lock);
+    for (int i = 0; i < pool->num_workers; i++)
+        pthread_join(pool->workers[i], NULL);
+    free(pool->workers);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->not_empty);
+    pthread_cond_destroy(&pool->not_full);
+    pthread_cond_destroy(&pool->all_done);
+}
+
+double wall_time() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main() {
     printf("Enter rows and columns of Matrix A: ");
     scanf("%d %d", &r1, &c1);
 
@@ -50,20 +157,26 @@ int main() {
         for (int j = 0; j < c2; j++)
             scanf("%d", &B[i][j]);
 
-    clock_t start_time, end_time;
-
-    start_time = clock();
-    for (int i = 0; i < r1; i++) {
-        threadData[i].row = i;
-        pthread_create(&threads[i], NULL, multiply_row, &threadData[i]);
-    }
-
-    for (int i = 0; i < r1; i++) {
-        pthread_join(threads[i], NULL);
+    // Workers are started once; the pool would be reused for further products
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int num_workers = cpus > 0 ? (int)cpus : 1;
+    double pool_start = wall_time();
+    ThreadPool pool;
+    if (pool_init(&pool, num_workers) != 0) {
+        fprintf(stderr, "Thread pool creation failed\n");
+        return 1;
     }
-
-    end_time = clock();
-    double time_taken = (double)(end_time - start_time) / CLOCKS_PER_SEC;
+    num_workers = pool.num_workers;
+    double pool_setup = wall_time() - pool_start;
+
+    // A few row blocks per worker for load balance
+    int num_blocks = num_workers * 4 < r1 ? num_workers * 4 : r1;
+    double start_time = wall_time();
+    for (int b = 0; b < num_blocks; b++)
+        pool_submit(&pool, r1 * b / num_blocks, r1 * (b + 1) / num_blocks);
+    pool_wait(&pool);
+    double time_taken = wall_time() - start_time;
+    pool_destroy(&pool);
 
     printf("Resultant Matrix C (%d x %d):\n", r1, c2);
     for (int i = 0; i < r1; i++) {
@@ -73,6 +186,7 @@ int main() {
         printf("\n");
     }
 
+    printf("Pool startup (%d workers): %.6f seconds\n", num_workers, pool_setup);
     printf("Total time taken: %.6f seconds\n", time_taken);
 
     return 0;
@@ -2,10 +2,12 @@
 #include <omp.h>
 using namespace std;
 
-void merge(int arr[], int l, int m, int r)
+// tmp is one buffer of N elements allocated in main; merge(l, m, r) only uses
+// tmp[l..r], so concurrent merges of disjoint ranges never share scratch space
+void merge(int arr[], int tmp[], int l, int m, int r)
 {
     int n1 = m - l + 1, n2 = r - m;
-    int *L = new int[n1], *R = new int[n2];
+    int *L = tmp + l, *R = tmp + m + 1;
 
     for (int i = 0; i < n1; i++)
         L[i] = arr[l + i];
@@ -19,23 +21,21 @@ void merge(int arr[], int l, int m, int r)
         arr[k++] = L[i++];
     while (j < n2)
         arr[k++] = R[j++];
-    delete[] L;
-    delete[] R;
 }
 
-void mergeSort(int arr[], int l, int r) {
+void mergeSort(int arr[], int tmp[], int l, int r) {
     if (l < r) {
         int m = (l + r) / 2;
 
 #pragma omp parallel sections
         {
 #pragma omp section
-            mergeSort(arr, l, m);
+            mergeSort(arr, tmp, l, m);
 
 #pragma omp section
-            mergeSort(arr, m + 1, r);
+            mergeSort(arr, tmp, m + 1, r);
         }
-        merge(arr, l, m, r);
+        merge(arr, tmp, l, m, r);
     }
 }
 
@@ -49,8 +49,9 @@ int main() {
     for (int i = 0; i < N; i++)
         cin >> arr[i];
 
+    int *tmp = new int[N];
     double start = omp_get_wtime();
-    mergeSort(arr, 0, N - 1);
+    mergeSort(arr, tmp, 0, N - 1);
     double end = omp_get_wtime();
 
     cout << "Sorted array: ";
@@ -59,5 +60,7 @@ int main() {
     cout << endl;
 
     cout << "Execution time: " << end - start << " seconds" << endl;
+    delete[] tmp;
+    delete[] arr;
     return 0;
 }
@@ -2,9 +2,64 @@
 #include <vector>
 #include <cmath>
 #include <omp.h>
+#include <algorithm>
 
 using namespace std;
 
+// Per-thread trace buffer: printf inside the parallel loop serializes the threads
+// on the stdout lock, so each thread records (thread, k, row, time) in its own ring
+// instead (no locks needed) and the events are printed after the solve. Same scheme
+// as the trace in gauss.cpp: recording is off until traceReset() sizes the rings.
+struct TraceEvent
+{
+    int thread, k, row;
+    double time;
+};
+
+const unsigned TRACE_CAPACITY = 1 << 14; // Events per thread (power of two); oldest are overwritten
+
+struct alignas(64) TraceRing // One cache line per counter: no false sharing
+{
+    vector<TraceEvent> events;
+    unsigned long long count = 0;
+};
+
+vector<TraceRing> traceRings;
+double traceStart;
+
+void traceReset()
+{
+    traceRings.assign(omp_get_max_threads(), TraceRing());
+    for (TraceRing &ring : traceRings)
+        ring.events.resize(TRACE_CAPACITY);
+    traceStart = omp_get_wtime();
+}
+
+inline void traceRecord(int k, int row)
+{
+    size_t t = omp_get_thread_num();
+    if (t >= traceRings.size())
+        return; // No traceReset() yet, or more threads than it sized for
+    TraceRing &ring = traceRings[t];
+    ring.events[ring.count & (TRACE_CAPACITY - 1)] = {(int)t, k, row, omp_get_wtime() - traceStart};
+    ring.count++;
+}
+
+void traceDump()
+{
+    vector<TraceEvent> all;
+    for (TraceRing &ring : traceRings)
+    {
+        unsigned long long kept = min<unsigned long long>(ring.count, TRACE_CAPACITY);
+        for (unsigned long long e = ring.count - kept; e < ring.count; e++)
+            all.push_back(ring.events[e & (TRACE_CAPACITY - 1)]);
+    }
+    sort(all.begin(), all.end(), [](const TraceEvent &a, const TraceEvent &b)
+         { return a.time < b.time; });
+    for (const TraceEvent &e : all)
+        printf("Thread %d updated row %d (k=%d, +%.1f us)\n", e.thread, e.row, e.k, e.time * 1e6);
+}
+
 void gaussian_elimination_parallel(vector<vector<double>> &A, vector<double> &b)
 {
     int n = A.size();
@@ -31,7 +86,7 @@ void gaussian_elimination_parallel(vector<vector<double>> &A, vector<double> &b)
                 A[i][j] -= factor * A[k][j];
             }
             b[i] -= factor * b[k];
-            printf("Thread %d updated row %d\n", omp_get_thread_num(), i);
+            traceRecord(k, i);
         }
     }
 }
@@ -63,10 +118,12 @@ int main()
     vector<double> b = {4, 8, 12};
 
     omp_set_num_threads(4); // Example: use 4 threads
+    traceReset();
     double start = omp_get_wtime();
     gaussian_elimination_parallel(A, b);
     vector<double> x = back_substitution(A, b);
     double end = omp_get_wtime();
+    traceDump();
 
     cout << "Parallel Solution:\n";
     for (int i = 0; i < N; i++)
@@ -5,6 +5,7 @@
 #include <sys/wait.h>   // For wait()
 #include <time.h>       // For clock()
 #include <pthread.h>    // For pthreads
+#include <string.h>     // For memcmp(), strerror()
 
 
 /*
@@ -114,38 +115,228 @@ void q2() {
 
 
 /*
- * --- Question 3: Matrix multiplication with pthreads ---
+ * --- Thread pool: fixed workers, bounded task queue ---
+ * Creating a thread costs tens of microseconds, which is more than a small
+ * matrix row takes to compute. The pool starts its workers once and they
+ * sleep on a condition variable until work arrives. Submitting blocks
+ * while the queue is full, so a producer can never run ahead unbounded.
  */
-#define MAX_DIM 10 // Max matrix dimension
+#define POOL_QUEUE_CAP 64
+
+
+typedef struct {
+    void (*fn)(void*);
+    void* arg;
+} PoolTask;
+
+
+typedef struct {
+    pthread_t* workers;
+    int num_workers;
+    PoolTask queue[POOL_QUEUE_CAP]; // Ring buffer
+    int head, tail, count;
+    int pending;                    // Submitted but not yet finished
+    int shutdown;
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;       // Workers wait here for tasks
+    pthread_cond_t not_full;        // Submitters wait here for a free slot
+    pthread_cond_t all_done;        // pool_wait() waits here for pending == 0
+} ThreadPool;
+
+
+void* pool_worker(void* arg) {
+    ThreadPool* pool = (ThreadPool*)arg;
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (pool->count == 0 && !pool->shutdown) {
+            pthread_cond_wait(&pool->not_empty, &pool->lock);
+        }
+        if (pool->count == 0 && pool->shutdown) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+        PoolTask task = pool->queue[pool->head];
+        pool->head = (pool->head + 1) % POOL_QUEUE_CAP;
+        pool->count--;
+        pthread_cond_signal(&pool->not_full);
+        pthread_mutex_unlock(&pool->lock);
 
+        task.fn(task.arg);
 
-int A[MAX_DIM][MAX_DIM];
-int B[MAX_DIM][MAX_DIM];
-int C[MAX_DIM][MAX_DIM];
-int r1, c1, r2, c2;
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0) {
+            pthread_cond_broadcast(&pool->all_done);
+        }
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
 
 
-struct ThreadArgs {
-    int row;
+int pool_init(ThreadPool* pool, int num_workers) {
+    pool->workers = (pthread_t*)malloc(num_workers * sizeof(pthread_t));
+    if (pool->workers == NULL) {
+        return -1;
+    }
+    pool->num_workers = 0;
+    pool->head = pool->tail = pool->count = pool->pending = 0;
+    pool->shutdown = 0;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->not_empty, NULL);
+    pthread_cond_init(&pool->not_full, NULL);
+    pthread_cond_init(&pool->all_done, NULL);
+    for (int i = 0; i < num_workers; i++) {
+        // pthread_create returns the error code instead of setting errno
+        int rc = pthread_create(&pool->workers[i], NULL, pool_worker, pool);
+        if (rc != 0) {
+            fprintf(stderr, "pthread_create: %s\n", strerror(rc));
+            break;
+        }
+        pool->num_workers++;
+    }
+    if (pool->num_workers == 0) {
+        // No worker started: release what was set up, pool_destroy will not be called
+        free(pool->workers);
+        pthread_mutex_destroy(&pool->lock);
+        pthread_cond_destroy(&pool->not_empty);
+        pthread_cond_destroy(&pool->not_full);
+        pthread_cond_destroy(&pool->all_done);
+        return -1;
+    }
+    return 0;
+}
+
+
+void pool_submit(ThreadPool* pool, void (*fn)(void*), void* arg) {
+    pthread_mutex_lock(&pool->lock);
+    while (pool->count == POOL_QUEUE_CAP) {
+        pthread_cond_wait(&pool->not_full, &pool->lock);
+    }
+    pool->queue[pool->tail].fn = fn;
+    pool->queue[pool->tail].arg = arg;
+    pool->tail = (pool->tail + 1) % POOL_QUEUE_CAP;
+    pool->count++;
+    pool->pending++;
+    pthread_cond_signal(&pool->not_empty);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+
+// Block until every submitted task has finished
+void pool_wait(ThreadPool* pool) {
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending > 0) {
+        pthread_cond_wait(&pool->all_done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+
+void pool_destroy(ThreadPool* pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->not_empty);
+    pthread_mutex_unlock(&pool->lock);
+    for (int i = 0; i < pool->num_workers; i++) {
+        pthread_join(pool->workers[i], NULL);
+    }
+    free(pool->workers);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->not_empty);
+    pthread_cond_destroy(&pool->not_full);
+    pthread_cond_destroy(&pool->all_done);
+}
+
+
+int num_cpus() {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+}
+
+
+double wall_time() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+/*
+ * --- Matrix multiplication on row blocks ---
+ * C (n x p) = A (n x m) * B (m x p), row-major. The rows of C are split
+ * into a few blocks per worker (enough for load balance, few enough that
+ * queue traffic stays negligible).
+ */
+#define POOL_BLOCKS_PER_WORKER 4
+
+
+struct MatMulJob {
+    const int* A;
+    const int* B;
+    int* C;
+    int n, m, p;
 };
 
 
-void* multiply_row(void* arg) {
-    struct ThreadArgs* args = (struct ThreadArgs*)arg;
-    int i = args->row;
+struct RowBlock {
+    struct MatMulJob* job;
+    int row_begin, row_end;
+};
 
 
-    for (int j = 0; j < c2; j++) {
-        C[i][j] = 0;
-        for (int k = 0; k < c1; k++) {
-            C[i][j] += A[i][k] * B[k][j];
+void multiply_rows(struct MatMulJob* job, int row_begin, int row_end) {
+    for (int i = row_begin; i < row_end; i++) {
+        int* c = job->C + (size_t)i * job->p;
+        for (int j = 0; j < job->p; j++) {
+            c[j] = 0;
+        }
+        for (int k = 0; k < job->m; k++) {
+            int a = job->A[(size_t)i * job->m + k];
+            const int* b = job->B + (size_t)k * job->p;
+            for (int j = 0; j < job->p; j++) {
+                c[j] += a * b[j];
+            }
         }
     }
-    free(arg);
-    pthread_exit(NULL);
 }
 
 
+void multiply_block(void* arg) {
+    struct RowBlock* block = (struct RowBlock*)arg;
+    multiply_rows(block->job, block->row_begin, block->row_end);
+}
+
+
+void pool_matmul(ThreadPool* pool, struct MatMulJob* job) {
+    if (job->n <= 0) {
+        return; // No rows: nothing to submit (and no zero-length block array)
+    }
+    int num_blocks = pool->num_workers * POOL_BLOCKS_PER_WORKER;
+    if (num_blocks > job->n) {
+        num_blocks = job->n;
+    }
+    struct RowBlock blocks[num_blocks];
+    for (int b = 0; b < num_blocks; b++) {
+        blocks[b].job = job;
+        blocks[b].row_begin = (int)((long long)job->n * b / num_blocks);
+        blocks[b].row_end = (int)((long long)job->n * (b + 1) / num_blocks);
+        pool_submit(pool, multiply_block, &blocks[b]);
+    }
+    pool_wait(pool);
+}
+
+
+/*
+ * --- Question 3: Matrix multiplication with pthreads ---
+ */
+#define MAX_DIM 10 // Max matrix dimension
+
+
+int A[MAX_DIM][MAX_DIM];
+int B[MAX_DIM][MAX_DIM];
+int C[MAX_DIM][MAX_DIM];
+int r1, c1, r2, c2;
+
+
 void q3() {
     printf("Enter dimensions of Matrix A (rows cols): ");
     scanf("%d %d", &r1, &c1);
@@ -161,6 +352,10 @@ void q3() {
         printf("Dimensions exceed MAX_DIM (%d)\n", MAX_DIM);
         return;
     }
+    if (r1 < 1 || c1 < 1 || r2 < 1 || c2 < 1) {
+        printf("Dimensions must be positive\n");
+        return;
+    }
 
 
     printf("Enter elements of Matrix A (%d x %d):\n", r1, c1);
@@ -179,19 +374,30 @@ void q3() {
     }
 
 
-    pthread_t threads[r1]; // One thread per result row
+    // Row blocks on a pool instead of one thread per result row
+    int a[MAX_DIM * MAX_DIM], b[MAX_DIM * MAX_DIM], c[MAX_DIM * MAX_DIM];
     for (int i = 0; i < r1; i++) {
-        struct ThreadArgs* args = (struct ThreadArgs*)malloc(sizeof(struct ThreadArgs));
-        args->row = i;
-        if (pthread_create(&threads[i], NULL, multiply_row, (void*)args) != 0) {
-            perror("pthread_create");
-            free(args);
+        for (int j = 0; j < c1; j++) {
+            a[i * c1 + j] = A[i][j];
         }
     }
-
-
+    for (int i = 0; i < r2; i++) {
+        for (int j = 0; j < c2; j++) {
+            b[i * c2 + j] = B[i][j];
+        }
+    }
+    struct MatMulJob job = {a, b, c, r1, c1, c2};
+    ThreadPool pool;
+    if (pool_init(&pool, num_cpus()) != 0) {
+        fprintf(stderr, "Thread pool creation failed\n");
+        return;
+    }
+    pool_matmul(&pool, &job);
+    pool_destroy(&pool);
     for (int i = 0; i < r1; i++) {
-        pthread_join(threads[i], NULL);
+        for (int j = 0; j < c2; j++) {
+            C[i][j] = c[i * c2 + j];
+        }
     }
 
 
@@ -251,12 +457,108 @@ void q4() {
 
 
 
+/*
+ * --- Question 5: Thread-per-row vs thread pool benchmark ---
+ * Repeats a multiplication many times with both schemes. The pool is
+ * created once and reused, the way a long-running program would use it;
+ * its startup cost is reported separately.
+ */
+struct SpawnArgs {
+    struct MatMulJob* job;
+    int row;
+};
+
+
+void* spawn_row(void* arg) {
+    struct SpawnArgs* args = (struct SpawnArgs*)arg;
+    multiply_rows(args->job, args->row, args->row + 1);
+    return NULL;
+}
+
+
+// The original scheme of q3(): create and join one thread per row
+void spawn_matmul(struct MatMulJob* job) {
+    pthread_t* threads = (pthread_t*)malloc(job->n * sizeof(pthread_t));
+    struct SpawnArgs* args = (struct SpawnArgs*)malloc(job->n * sizeof(struct SpawnArgs));
+    for (int i = 0; i < job->n; i++) {
+        args[i].job = job;
+        args[i].row = i;
+        if (pthread_create(&threads[i], NULL, spawn_row, &args[i]) != 0) {
+            perror("pthread_create");
+            exit(1);
+        }
+    }
+    for (int i = 0; i < job->n; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+    free(args);
+}
+
+
+void q5() {
+    int sizes[] = {8, 32, 128, 512};
+    int reps[] = {2000, 500, 20, 2};
+
+    double start = wall_time();
+    ThreadPool pool;
+    if (pool_init(&pool, num_cpus()) != 0) {
+        fprintf(stderr, "Thread pool creation failed\n");
+        return;
+    }
+    printf("Pool: %d workers, started in %.6f seconds\n\n", pool.num_workers, wall_time() - start);
+
+    printf("%8s %8s %18s %18s %18s %8s\n", "N", "Reps", "Spawn (s/mult)", "Pool (s/mult)", "Saved (s/mult)", "Match");
+    for (int t = 0; t < 4; t++) {
+        int n = sizes[t];
+        size_t elems = (size_t)n * n;
+        int* a = (int*)malloc(elems * sizeof(int));
+        int* b = (int*)malloc(elems * sizeof(int));
+        int* c_spawn = (int*)malloc(elems * sizeof(int));
+        int* c_pool = (int*)malloc(elems * sizeof(int));
+        if (a == NULL || b == NULL || c_spawn == NULL || c_pool == NULL) {
+            printf("Memory allocation failed\n");
+            free(a); free(b); free(c_spawn); free(c_pool);
+            break;
+        }
+        for (size_t i = 0; i < elems; i++) {
+            a[i] = rand() % 10;
+            b[i] = rand() % 10;
+        }
+
+        struct MatMulJob spawn_job = {a, b, c_spawn, n, n, n};
+        struct MatMulJob pool_job = {a, b, c_pool, n, n, n};
+
+        start = wall_time();
+        for (int r = 0; r < reps[t]; r++) {
+            spawn_matmul(&spawn_job);
+        }
+        double spawn_time = (wall_time() - start) / reps[t];
+
+        start = wall_time();
+        for (int r = 0; r < reps[t]; r++) {
+            pool_matmul(&pool, &pool_job);
+        }
+        double pool_time = (wall_time() - start) / reps[t];
+
+        int match = memcmp(c_spawn, c_pool, elems * sizeof(int)) == 0;
+        printf("%8d %8d %18.8f %18.8f %18.8f %8s\n", n, reps[t], spawn_time, pool_time,
+               spawn_time - pool_time, match ? "yes" : "NO");
+        free(a); free(b); free(c_spawn); free(c_pool);
+    }
+
+    pool_destroy(&pool);
+}
+
+
+
+
 /*
  * --- Main Function to Select Question ---
  */
 int main() {
     int choice;
-    printf("Choose a question to run (1-4): ");
+    printf("Choose a question to run (1-5): ");
     scanf("%d", &choice);
 
 
@@ -277,6 +579,10 @@ int main() {
             printf("\n--- Running Q4 ---\n");
             q4();
             break;
+        case 5:
+            printf("\n--- Running Q5 ---\n");
+            q5();
+            break;
         default:
             printf("Invalid choice.\n");
     }
@@ -4,21 +4,27 @@
 #include <algorithm> // For std::swap and std::sort (for creating sorted array)
 #include <cstdlib>   // For rand() and srand()
 #include <ctime>     // For time()
+#include <climits>   // For INT_MAX
+#include <cstdint>   // For uint16_t
 
 using namespace std;
 
-// --- Partition Function (Lomuto's Scheme) ---
-// This function rearranges the array based on a pivot.
-// strategy: 0=middle, 1=first, 2=last
-int partition(vector<int>& arr, int low, int high, int strategy) {
-    int pivot_index;
+// Index of the pivot for a strategy: 0=middle, 1=first, 2=last
+int strategy_pivot(int low, int high, int strategy) {
     if (strategy == 0) { // Middle element
-        pivot_index = low + (high - low) / 2;
+        return low + (high - low) / 2;
     } else if (strategy == 1) { // First element
-        pivot_index = low;
+        return low;
     } else { // Last element
-        pivot_index = high;
+        return high;
     }
+}
+
+// --- Partition Function (Lomuto's Scheme) ---
+// This function rearranges the array based on a pivot.
+// strategy: 0=middle, 1=first, 2=last
+int partition(vector<int>& arr, int low, int high, int strategy) {
+    int pivot_index = strategy_pivot(low, high, strategy);
 
     // Move the chosen pivot to the end (high) to use as the Lomuto pivot
     swap(arr[pivot_index], arr[high]);
@@ -50,32 +56,137 @@ void quick_sort_serial(vector<int>& arr, int low, int high, int strategy) {
     }
 }
 
+// --- Parallel In-Place Partition ---
+// partition() scans the whole range on one thread, so at the root all other threads
+// wait for N comparisons before the first task exists. Here the range (without the
+// pivot) is cut into `parts` blocks:
+//   1. each block is partitioned on its own (Lomuto, keys <= pivot first) as a task;
+//      block p then holds c_p small keys followed by its large keys
+//   2. the small keys belong in [low, low + L) with L = sum of the c_p. Large keys
+//      inside that region and small keys beyond it are misplaced; both form a list
+//      of at most `parts` intervals and there are equally many of each. Prefix sums
+//      of the interval lengths number the misplaced keys on both sides.
+//   3. the i-th misplaced large key is swapped with the i-th misplaced small key;
+//      the numbering is split into `parts` equal chunks, swapped as tasks.
+// The result is the same split as partition(), in place, with the pivot at low + L.
+
+const int PAR_PARTITION_MIN = 1 << 16; // Smaller ranges are partitioned serially
+
+// Misplaced keys: intervals [begin, end) and the running count before each one
+struct Misplaced {
+    vector<int> begin, end, before;
+    int total = 0;
+    void add(int b, int e) {
+        if (b < e) {
+            begin.push_back(b);
+            end.push_back(e);
+            before.push_back(total);
+            total += e - b;
+        }
+    }
+    // Position of misplaced key number k (0 <= k < total)
+    int position(int k, int& interval) const {
+        interval = (int)(upper_bound(before.begin(), before.end(), k) - before.begin()) - 1;
+        return begin[interval] + (k - before[interval]);
+    }
+};
+
+int parallel_partition(vector<int>& arr, int low, int high, int strategy, int parts) {
+    swap(arr[strategy_pivot(low, high, strategy)], arr[high]);
+    int pivot_value = arr[high];
+    int n = high - low; // Keys to partition: [low, high)
+    vector<int> block_begin(parts + 1), small_count(parts);
+    for (int p = 0; p <= parts; p++) {
+        block_begin[p] = low + (int)((long long)n * p / parts);
+    }
+
+    // 1. Partition the blocks independently
+    #pragma omp taskloop shared(arr, block_begin, small_count)
+    for (int p = 0; p < parts; p++) {
+        int i = block_begin[p];
+        for (int j = block_begin[p]; j < block_begin[p + 1]; j++) {
+            if (arr[j] <= pivot_value) {
+                swap(arr[i], arr[j]);
+                i++;
+            }
+        }
+        small_count[p] = i - block_begin[p];
+    }
+
+    // 2. Locate the misplaced keys
+    int split = low;
+    for (int p = 0; p < parts; p++) {
+        split += small_count[p];
+    }
+    Misplaced large, small; // Large keys left of split, small keys right of it
+    for (int p = 0; p < parts; p++) {
+        int mid = block_begin[p] + small_count[p];
+        large.add(max(mid, low), min(block_begin[p + 1], split));
+        small.add(max(block_begin[p], split), min(mid, high));
+    }
+
+    // 3. Swap them pairwise
+    int total = large.total; // == small.total
+    #pragma omp taskloop shared(arr, large, small)
+    for (int q = 0; q < parts; q++) {
+        int k = (int)((long long)total * q / parts);
+        int k_end = (int)((long long)total * (q + 1) / parts);
+        if (k >= k_end) {
+            continue;
+        }
+        int li, si;
+        int lpos = large.position(k, li);
+        int spos = small.position(k, si);
+        for (; k < k_end; k++) {
+            if (lpos == large.end[li]) lpos = large.begin[++li];
+            if (spos == small.end[si]) spos = small.begin[++si];
+            swap(arr[lpos++], arr[spos++]);
+        }
+    }
+
+    swap(arr[split], arr[high]);
+    return split;
+}
+
 // --- Parallel Quick Sort (Task-based) ---
 // This recursive function creates tasks for parallel execution.
+// While fewer ranges than threads are being partitioned (depth d has up to 2^d of
+// them), each range is partitioned with parallel_partition in (threads / 2^d) blocks.
 
 // Cutoff: Sub-arrays smaller than this will be sorted serially.
 // This avoids the overhead of creating tasks for tiny amounts of work.
 const int CUTOFF = 1000; 
 
-void quick_sort_task(vector<int>& arr, int low, int high, int strategy) {
+// Blocks for a parallel_partition at recursion depth `depth`: threads / 2^depth
+int partition_parts(int depth) {
+    return (depth < 30) ? (omp_get_num_threads() >> depth) : 0;
+}
+
+void quick_sort_task(vector<int>& arr, int low, int high, int strategy, int depth = 0) {
     if (low < high) {
         // If the sub-array is small, sort it serially
         if ((high - low) < CUTOFF) {
             quick_sort_serial(arr, low, high, strategy);
         } else {
             // Partition the array
-            int pi = partition(arr, low, high, strategy);
+            int parts = partition_parts(depth);
+            int pi;
+            if (parts > 1 && (high - low) >= PAR_PARTITION_MIN) {
+                pi = parallel_partition(arr, low, high, strategy, parts);
+            } else {
+                pi = partition(arr, low, high, strategy);
+            }
 
-            // Create a task for the left sub-array
-            #pragma omp task
+            // Create a task for the left sub-array (shared, so the task sorts arr in place)
+            #pragma omp task shared(arr)
             {
-                quick_sort_task(arr, low, pi - 1, strategy);
+                quick_sort_task(arr, low, pi - 1, strategy, depth + 1);
             }
 
             // Create a task for the right sub-array
-            #pragma omp task
+            #pragma omp task shared(arr)
             {
-                quick_sort_task(arr, pi + 1, high, strategy);
+                quick_sort_task(arr, pi + 1, high, strategy, depth + 1);
             }
         }
     }
@@ -96,6 +207,300 @@ void quick_sort_parallel(vector<int>& arr, int n, int strategy) {
       // ensures all tasks are completed before the function returns.
 }
 
+// --- Introsort Engine ---
+// The Lomuto quicksort above is the textbook version: a fixed pivot position makes
+// sorted input quadratic, runs of equal keys are split one element at a time, and
+// the recursion can go N levels deep. This engine keeps the quicksort structure but:
+//   * pivot: median of 3 (first, middle, last), or for more than INTRO_NINTHER
+//     elements Tukey's ninther (median of the medians of three triples)
+//   * partition: Hoare in blocks without branches (see partition_branchless), so
+//     random data does not mispredict on every other element, and a range that is
+//     already partitioned is left untouched (sorted input stays sorted)
+//   * duplicates: arr[low - 1] is never larger than anything in [low, high]; when the
+//     pivot equals it, the range holds no smaller key, so all keys equal to the pivot
+//     are partitioned off in one pass and never touched again (3-way effect)
+//   * depth limit 2 log2(N): past it the range is heapsorted (introsort), so the
+//     worst case is O(N log N)
+//   * insertion sort below INTRO_INSERTION elements
+//   * the smaller side is handled by a recursive call, the larger one by the loop,
+//     so the stack never grows beyond log2(N) frames
+//   * tasks: each range carries a budget of tasks it may still create, starting at
+//     INTRO_OVERSUBSCRIBE per thread and split between the two sides by size. The
+//     smaller side becomes a task while the budget lasts and it is worth a task.
+
+const int INTRO_INSERTION = 24;
+const int INTRO_NINTHER = 128;
+const int INTRO_TASK_MIN = 1 << 14;  // Smallest side worth a task
+const int INTRO_OVERSUBSCRIBE = 4;   // Tasks per thread, for load balance
+
+void insertion_sort(vector<int>& arr, int low, int high) {
+    for (int i = low + 1; i <= high; i++) {
+        int v = arr[i];
+        int j = i - 1;
+        while (j >= low && arr[j] > v) {
+            arr[j + 1] = arr[j];
+            j--;
+        }
+        arr[j + 1] = v;
+    }
+}
+
+// Orders arr[a] <= arr[b] <= arr[c]
+inline void sort3(vector<int>& arr, int a, int b, int c) {
+    if (arr[b] < arr[a]) swap(arr[a], arr[b]);
+    if (arr[c] < arr[b]) swap(arr[b], arr[c]);
+    if (arr[b] < arr[a]) swap(arr[a], arr[b]);
+}
+
+// Moves the median of 3 (or the ninther) to arr[low]
+void choose_pivot(vector<int>& arr, int low, int high) {
+    int n = high - low + 1;
+    int mid = low + n / 2;
+    if (n > INTRO_NINTHER) {
+        sort3(arr, low, mid, high);
+        sort3(arr, low + 1, mid - 1, high - 1);
+        sort3(arr, low + 2, mid + 1, high - 2);
+        sort3(arr, mid - 1, mid, mid + 1);
+        swap(arr[low], arr[mid]);
+    } else {
+        sort3(arr, mid, low, high);
+    }
+}
+
+// Branchless Hoare partition around the pivot in arr[low] (BlockQuicksort). Keys for
+// which (key < pivot), or (key <= pivot) when or_equal is set, end up left of the
+// pivot. A block of INTRO_BLOCK keys is scanned from each end and the offsets of the
+// keys on the wrong side are recorded: the comparison result only advances the
+// offset count, so there is no branch to mispredict. Misplaced pairs are then
+// swapped. The leftover middle (under two blocks) is finished by a plain Hoare scan.
+// Returns the final position of the pivot.
+const int INTRO_BLOCK = 64;
+
+int partition_branchless(vector<int>& arr, int low, int high, bool or_equal) {
+    int* a = arr.data();
+    int pivot = a[low];
+    int eq = or_equal;
+    int l = low + 1, r = high; // a[low+1 .. l) belong left, (r .. high] right
+    unsigned char off_l[INTRO_BLOCK], off_r[INTRO_BLOCK];
+    int num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+    while (r - l + 1 > 2 * INTRO_BLOCK) {
+        if (num_l == 0) {
+            start_l = 0;
+            for (int i = 0; i < INTRO_BLOCK; i++) {
+                int x = a[l + i];
+                off_l[num_l] = (unsigned char)i;
+                num_l += !((x < pivot) | (eq & (x == pivot)));
+            }
+        }
+        if (num_r == 0) {
+            start_r = 0;
+            for (int i = 0; i < INTRO_BLOCK; i++) {
+                int x = a[r - i];
+                off_r[num_r] = (unsigned char)i;
+                num_r += (x < pivot) | (eq & (x == pivot));
+            }
+        }
+        int num = min(num_l, num_r);
+        for (int k = 0; k < num; k++) {
+            swap(a[l + off_l[start_l + k]], a[r - off_r[start_r + k]]);
+        }
+        num_l -= num;
+        num_r -= num;
+        start_l += num;
+        start_r += num;
+        if (num_l == 0) l += INTRO_BLOCK;
+        if (num_r == 0) r -= INTRO_BLOCK;
+    }
+    // A block with misplaced keys left over is still inside [l, r] and simply rescanned
+    while (true) {
+        while (l <= r && ((a[l] < pivot) | (eq & (a[l] == pivot)))) l++;
+        while (l <= r && !((a[r] < pivot) | (eq & (a[r] == pivot)))) r--;
+        if (l > r) break;
+        swap(a[l], a[r]);
+        l++;
+        r--;
+    }
+    swap(a[low], a[l - 1]);
+    return l - 1;
+}
+
+// leftmost: no arr[low - 1] bounds the range from below
+void introsort_loop(vector<int>& arr, int low, int high, int depth_limit, int budget, bool leftmost) {
+    while (high - low + 1 > INTRO_INSERTION) {
+        if (depth_limit == 0) {
+            make_heap(arr.begin() + low, arr.begin() + high + 1);
+            sort_heap(arr.begin() + low, arr.begin() + high + 1);
+            return;
+        }
+        depth_limit--;
+
+        choose_pivot(arr, low, high);
+        if (!leftmost && arr[low - 1] == arr[low]) {
+            // Nothing in the range is smaller than the pivot: the left side is all
+            // keys equal to it, which are already in place
+            low = partition_branchless(arr, low, high, true) + 1;
+            continue;
+        }
+        int pi = partition_branchless(arr, low, high, false);
+
+        int left_n = pi - low;
+        int right_n = high - pi;
+        bool left_smaller = left_n < right_n;
+        int small_low = left_smaller ? low : pi + 1;
+        int small_high = left_smaller ? pi - 1 : high;
+        bool small_leftmost = left_smaller && leftmost;
+        int small_n = min(left_n, right_n);
+
+        if (budget > 1 && small_n >= INTRO_TASK_MIN) {
+            int small_budget = max(1, (int)((long long)budget * small_n / (left_n + right_n)));
+            budget = max(1, budget - small_budget);
+            #pragma omp task shared(arr)
+            introsort_loop(arr, small_low, small_high, depth_limit, small_budget, small_leftmost);
+        } else {
+            introsort_loop(arr, small_low, small_high, depth_limit, 1, small_leftmost);
+        }
+
+        // Continue with the larger side
+        if (left_smaller) {
+            low = pi + 1;
+            leftmost = false;
+        } else {
+            high = pi - 1;
+        }
+    }
+    insertion_sort(arr, low, high);
+}
+
+void introsort_parallel(vector<int>& arr, int n) {
+    int depth_limit = 2 * (32 - __builtin_clz(max(n, 1)));
+    #pragma omp parallel
+    {
+        #pragma omp single nowait
+        introsort_loop(arr, 0, n - 1, depth_limit, omp_get_num_threads() * INTRO_OVERSUBSCRIBE, true);
+    }
+}
+
+// --- Parallel Sample Sort ---
+// quick_sort_parallel partitions the whole array on one thread before the first task
+// exists, and one bad pivot puts nearly everything into a single task. Sample sort
+// picks many pivots at once, from a sample, so every step is parallel and the bucket
+// sizes do not depend on how the input is ordered:
+//   1. Splitters: sort a random sample of SAMPLE_OVERSAMPLING * k elements and take
+//      every SAMPLE_OVERSAMPLING-th one as one of k - 1 splitters.
+//   2. Classify: every thread finds the bucket of each element of its block by
+//      walking a complete binary search tree of the splitters, and counts them.
+//      The walk has no branches: j = 2 * j + (x > tree[j]), log2(k) times.
+//   3. Redistribute: a prefix sum over the (bucket, thread) counts gives each thread
+//      its slice of every bucket, and each thread copies its elements into a buffer.
+//   4. Sort the buckets in parallel (dynamic schedule) and copy them back.
+// Elements equal to a splitter go to an "equality bucket" that needs no sorting, so
+// inputs with many duplicates (or all keys equal) do not produce one huge bucket.
+
+const int SAMPLE_SORT_MIN = 1 << 15;    // Below this std::sort on one thread is faster
+const int SAMPLE_BUCKET_MIN = 1 << 12;  // Target minimum elements per bucket
+const int SAMPLE_MAX_LOG_BUCKETS = 8;   // At most 256 buckets
+const int SAMPLE_OVERSAMPLING = 16;
+
+struct alignas(64) BucketCounts {
+    int c[2 << SAMPLE_MAX_LOG_BUCKETS]; // A regular and an equality bucket per splitter
+};
+
+void sample_sort_parallel(vector<int>& arr, int n) {
+    if (n < SAMPLE_SORT_MIN) {
+        sort(arr.begin(), arr.begin() + n);
+        return;
+    }
+    int logK = 1;
+    while (logK < SAMPLE_MAX_LOG_BUCKETS && (n >> (logK + 1)) >= SAMPLE_BUCKET_MIN) {
+        logK++;
+    }
+    int k = 1 << logK;
+    int buckets = 2 * k;
+
+    // 1. Splitters from a sorted random sample
+    int sample_size = SAMPLE_OVERSAMPLING * k;
+    vector<int> sample(sample_size);
+    unsigned int seed = 12345;
+    for (int i = 0; i < sample_size; i++) {
+        sample[i] = arr[(int)(((unsigned long long)rand_r(&seed) * RAND_MAX + rand_r(&seed)) % n)];
+    }
+    sort(sample.begin(), sample.end());
+    vector<int> splitter(k);                // splitter[k - 1] is a sentinel
+    vector<int> tree(k);                    // tree[1..k-1]: implicit binary search tree
+    for (int i = 0; i < k - 1; i++) {
+        splitter[i] = sample[(i + 1) * SAMPLE_OVERSAMPLING - 1];
+    }
+    splitter[k - 1] = INT_MAX;
+    // Node j has children 2j and 2j + 1; the q-th node on depth d holds the splitter
+    // of rank (2q + 1) * k / 2^(d+1), so an in-order walk visits them sorted
+    for (int j = 1; j < k; j++) {
+        int depth = 31 - __builtin_clz(j);
+        int step = k >> depth;              // Distance between splitters on this depth
+        int rank = (j - (1 << depth)) * step + step / 2;
+        tree[j] = splitter[rank - 1];
+    }
+
+    vector<uint16_t> oracle(n);             // Bucket of every element, from step 2
+    vector<int> aux(n);
+    int threads = omp_get_max_threads();
+    vector<BucketCounts> counts(threads);
+    vector<int> bucket_start(buckets + 1);
+
+    #pragma omp parallel num_threads(threads)
+    {
+        int t = omp_get_thread_num();
+        int T = omp_get_num_threads();
+        int begin = (int)((long long)n * t / T);
+        int end = (int)((long long)n * (t + 1) / T);
+        int* c = counts[t].c;
+        fill_n(c, buckets, 0);
+
+        // 2. Classify
+        for (int i = begin; i < end; i++) {
+            int x = arr[i];
+            int j = 1;
+            for (int level = 0; level < logK; level++) {
+                j = 2 * j + (x > tree[j]);
+            }
+            int b = j - k;                  // Number of splitters smaller than x
+            b = 2 * b + (x == splitter[b]);
+            oracle[i] = (uint16_t)b;
+            c[b]++;
+        }
+        #pragma omp barrier
+
+        #pragma omp single
+        {
+            int sum = 0;
+            for (int b = 0; b < buckets; b++) {
+                bucket_start[b] = sum;
+                for (int u = 0; u < T; u++) {
+                    int count = counts[u].c[b];
+                    counts[u].c[b] = sum;
+                    sum += count;
+                }
+            }
+            bucket_start[buckets] = sum;
+        }
+
+        // 3. Redistribute into aux
+        for (int i = begin; i < end; i++) {
+            aux[c[oracle[i]]++] = arr[i];
+        }
+        #pragma omp barrier
+
+        // 4. Sort the regular buckets and copy every bucket back
+        #pragma omp for schedule(dynamic, 1)
+        for (int b = 0; b < buckets; b++) {
+            if (b % 2 == 0) {
+                sort(aux.begin() + bucket_start[b], aux.begin() + bucket_start[b + 1]);
+            }
+            copy(aux.begin() + bucket_start[b], aux.begin() + bucket_start[b + 1], arr.begin() + bucket_start[b]);
+        }
+    }
+}
+
 // --- Utility to print the array ---
 void print_array(const vector<int>& arr) {
     int n = arr.size();
@@ -207,12 +612,65 @@ int main() {
     end_time = omp_get_wtime();
     cout << "Time: " << (end_time - start_time) << " seconds." << endl;
 
+    // --- Test Case 7: Unsorted array - Sample sort ---
+    cout << "\nTest 7: Unsorted, Parallel Sample Sort" << endl;
+    arr_test = arr_orig; // Reset
+    start_time = omp_get_wtime();
+    sample_sort_parallel(arr_test, n);
+    end_time = omp_get_wtime();
+    cout << "Time: " << (end_time - start_time) << " seconds." << endl;
+    cout << "Correct: " << (arr_test == arr_sorted ? "yes" : "NO") << endl;
+
+    // --- Test Case 8: Sorted array - Sample sort ---
+    cout << "\nTest 8: Sorted, Parallel Sample Sort" << endl;
+    arr_test = arr_sorted; // Reset to sorted array
+    start_time = omp_get_wtime();
+    sample_sort_parallel(arr_test, n);
+    end_time = omp_get_wtime();
+    cout << "Time: " << (end_time - start_time) << " seconds." << endl;
+    cout << "Correct: " << (arr_test == arr_sorted ? "yes" : "NO") << endl;
+
+    // --- Test Case 9: Unsorted array - Introsort ---
+    cout << "\nTest 9: Unsorted, Parallel Introsort" << endl;
+    arr_test = arr_orig; // Reset
+    start_time = omp_get_wtime();
+    introsort_parallel(arr_test, n);
+    end_time = omp_get_wtime();
+    cout << "Time: " << (end_time - start_time) << " seconds." << endl;
+    cout << "Correct: " << (arr_test == arr_sorted ? "yes" : "NO") << endl;
+
+    // --- Test Case 10: Sorted array - Introsort ---
+    cout << "\nTest 10: Sorted, Parallel Introsort" << endl;
+    arr_test = arr_sorted; // Reset to sorted array
+    start_time = omp_get_wtime();
+    introsort_parallel(arr_test, n);
+    end_time = omp_get_wtime();
+    cout << "Time: " << (end_time - start_time) << " seconds." << endl;
+    cout << "Correct: " << (arr_test == arr_sorted ? "yes" : "NO") << endl;
+
+    // --- Test Case 11: Few distinct keys - Introsort ---
+    cout << "\nTest 11: Only 4 Distinct Keys, Parallel Introsort" << endl;
+    vector<int> arr_dup(n);
+    for (int i = 0; i < n; i++) {
+        arr_dup[i] = arr_orig[i] % 4;
+    }
+    vector<int> arr_dup_sorted = arr_dup;
+    sort(arr_dup_sorted.begin(), arr_dup_sorted.end());
+    arr_test = arr_dup;
+    start_time = omp_get_wtime();
+    introsort_parallel(arr_test, n);
+    end_time = omp_get_wtime();
+    cout << "Time: " << (end_time - start_time) << " seconds." << endl;
+    cout << "Correct: " << (arr_test == arr_dup_sorted ? "yes" : "NO") << endl;
+
 
     cout << "\n--- Justification of Results ---" << endl;
     cout << "Fill in a table with your observed times. You will likely see:\n" << endl;
     cout << "* **Test 1, 2, 3 (Unsorted):** These should all have fast, similar times. They represent the Average Case (O(n log n)) because the random data leads to good partitions.\n" << endl;
     cout << "* **Test 4 & 5 (Sorted, Pivot=First/Last):** These will be **significantly slower**. This is the Worst Case (O(n^2)). The pivot is always the smallest (Test 4) or largest (Test 5) element. The partition is extremely unbalanced (0 elements on one side, n-1 on the other). This prevents any meaningful parallelism and the recursion depth becomes 'n'.\n" << endl;
     cout << "* **Test 6 (Sorted, Pivot=Middle):** This will be fast again, even on sorted data. This is because picking the middle element of a sorted array is the *perfect* pivot, resulting in the Best Case (O(n log n)).\n" << endl;
+    cout << "* **Test 7 & 8 (Sample Sort):** Neither input is a worst case (sorted input is even faster). The splitters come from a random sample, so the bucket sizes do not depend on the input order, and classification, redistribution and bucket sorting all run on every thread.\n" << endl;
+    cout << "* **Test 9, 10, 11 (Introsort):** Fast on all three. The ninther finds the true middle of sorted data, keys equal to the pivot are split off in one pass instead of one at a time, and heapsort bounds anything that still goes wrong to O(n log n).\n" << endl;
 
     cout << "--- Example Table (Fill with your values) ---" << endl;
     cout << "------------------------------------------------------------------------------------------------------" << endl;
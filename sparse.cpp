@@ -0,0 +1,328 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <omp.h>
+#include <iomanip>   // For setprecision, setw
+#include <cmath>     // For fabs
+#include <algorithm> // For sort, max, stable_sort
+#include "gemm.h"
+
+using namespace std;
+
+// Sparse matrix kernels: SpMV (CSR and SELL-C-sigma) and SpGEMM (Gustavson)
+//
+// A dense N x N product costs 2N^3 flops and N^2 memory no matter how many entries
+// are zero. Storing only the nonzeros makes SpMV cost O(nnz) and SpGEMM cost
+// O(flops actually needed), which wins by orders of magnitude at low density. main()
+// compares both against the dense path (gemm.h) as the density grows.
+
+// Compressed Sparse Row matrix, column indices sorted within each row
+struct CSRMatrix {
+    int rows, cols;
+    vector<int> rowPtr; // Size rows + 1
+    vector<int> col;
+    vector<double> val;
+    size_t nnz() const { return val.size(); }
+};
+
+// Random rows x cols matrix with round(density * cols) nonzeros in every row
+CSRMatrix randomSparse(int rows, int cols, double density, unsigned int seed) {
+    CSRMatrix A;
+    A.rows = rows;
+    A.cols = cols;
+    int perRow = max(1, (int)(density * cols + 0.5));
+    mt19937 gen(seed);
+    uniform_int_distribution<int> pickCol(0, cols - 1);
+    uniform_real_distribution<double> pickVal(-1.0, 1.0);
+    vector<int> marker(cols, -1);
+    A.rowPtr.push_back(0);
+    for (int i = 0; i < rows; ++i) {
+        int start = A.col.size();
+        while ((int)A.col.size() - start < perRow) {
+            int j = pickCol(gen);
+            if (marker[j] != i) {
+                marker[j] = i;
+                A.col.push_back(j);
+            }
+        }
+        sort(A.col.begin() + start, A.col.end());
+        for (int p = start; p < (int)A.col.size(); ++p) {
+            A.val.push_back(pickVal(gen));
+        }
+        A.rowPtr.push_back(A.col.size());
+    }
+    return A;
+}
+
+// Row-major dense copy, for the dense baseline
+vector<double> toDense(const CSRMatrix& A) {
+    vector<double> D((size_t)A.rows * A.cols, 0.0);
+    for (int i = 0; i < A.rows; ++i) {
+        for (int p = A.rowPtr[i]; p < A.rowPtr[i + 1]; ++p) {
+            D[(size_t)i * A.cols + A.col[p]] = A.val[p];
+        }
+    }
+    return D;
+}
+
+// --- SpMV ---
+
+// y = A * x on CSR
+void spmvCSR(const CSRMatrix& A, const vector<double>& x, vector<double>& y) {
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < A.rows; ++i) {
+        double s = 0.0;
+        for (int p = A.rowPtr[i]; p < A.rowPtr[i + 1]; ++p) {
+            s += A.val[p] * x[A.col[p]];
+        }
+        y[i] = s;
+    }
+}
+
+// SELL-C-sigma: rows are grouped into chunks of SELL_C, each chunk padded to its
+// longest row and stored column-major, so one SIMD lane handles one row and the
+// j-th entries of all SELL_C rows are contiguous. Sorting rows by length within
+// windows of SELL_SIGMA rows puts rows of similar length in the same chunk, which
+// keeps the padding small without destroying the locality of x.
+const int SELL_C = 8;       // One AVX-512 register of doubles
+const int SELL_SIGMA = 256; // Sorting window
+
+struct SellMatrix {
+    int rows, chunks;
+    vector<int> chunkPtr; // Offset of each chunk, size chunks + 1
+    vector<int> chunkLen; // Padded row length of each chunk
+    vector<int> perm;     // Original row of each sorted slot (-1 for padding)
+    vector<int> col;
+    vector<double> val;
+};
+
+SellMatrix toSell(const CSRMatrix& A) {
+    SellMatrix S;
+    S.rows = A.rows;
+    S.chunks = (A.rows + SELL_C - 1) / SELL_C;
+    S.perm.assign((size_t)S.chunks * SELL_C, -1);
+    for (int i = 0; i < A.rows; ++i) {
+        S.perm[i] = i;
+    }
+    auto len = [&](int i) { return A.rowPtr[i + 1] - A.rowPtr[i]; };
+    for (int w = 0; w < A.rows; w += SELL_SIGMA) {
+        int end = min(A.rows, w + SELL_SIGMA);
+        stable_sort(S.perm.begin() + w, S.perm.begin() + end, [&](int a, int b) { return len(a) > len(b); });
+    }
+
+    S.chunkPtr.assign(S.chunks + 1, 0);
+    S.chunkLen.assign(S.chunks, 0);
+    for (int c = 0; c < S.chunks; ++c) {
+        int longest = 0;
+        for (int r = 0; r < SELL_C; ++r) {
+            int i = S.perm[c * SELL_C + r];
+            if (i >= 0) {
+                longest = max(longest, len(i));
+            }
+        }
+        S.chunkLen[c] = longest;
+        S.chunkPtr[c + 1] = S.chunkPtr[c] + longest * SELL_C;
+    }
+    // Padding entries: value 0, column 0 (a valid address, so no branch in the kernel)
+    S.col.assign(S.chunkPtr[S.chunks], 0);
+    S.val.assign(S.chunkPtr[S.chunks], 0.0);
+    #pragma omp parallel for schedule(static)
+    for (int c = 0; c < S.chunks; ++c) {
+        for (int r = 0; r < SELL_C; ++r) {
+            int i = S.perm[c * SELL_C + r];
+            if (i < 0) {
+                continue;
+            }
+            for (int p = A.rowPtr[i], j = 0; p < A.rowPtr[i + 1]; ++p, ++j) {
+                S.col[S.chunkPtr[c] + j * SELL_C + r] = A.col[p];
+                S.val[S.chunkPtr[c] + j * SELL_C + r] = A.val[p];
+            }
+        }
+    }
+    return S;
+}
+
+// y = A * x on SELL-C-sigma
+void spmvSell(const SellMatrix& S, const vector<double>& x, vector<double>& y) {
+    #pragma omp parallel for schedule(static)
+    for (int c = 0; c < S.chunks; ++c) {
+        double acc[SELL_C] = {};
+        const int* col = &S.col[S.chunkPtr[c]];
+        const double* val = &S.val[S.chunkPtr[c]];
+        for (int j = 0; j < S.chunkLen[c]; ++j) {
+            #pragma omp simd
+            for (int r = 0; r < SELL_C; ++r) {
+                acc[r] += val[j * SELL_C + r] * x[col[j * SELL_C + r]];
+            }
+        }
+        for (int r = 0; r < SELL_C; ++r) {
+            int i = S.perm[c * SELL_C + r];
+            if (i >= 0) {
+                y[i] = acc[r];
+            }
+        }
+    }
+}
+
+// --- SpGEMM: C = A * B, row by row (Gustavson) ---
+//
+// Row i of C is the sum of rows k of B scaled by a(i, k). Each thread keeps a dense
+// accumulator over the columns of B plus a marker array telling which columns row i
+// has touched already (marker[j] == i), so no clearing is needed between rows.
+//
+// Pass 1 (symbolic) only counts the distinct columns of every row of C. A prefix sum
+// turns the counts into rowPtr, and col/val are allocated once at their exact final
+// size. Pass 2 (numeric) then writes every row straight into its slot: no per-row
+// vectors, no reallocation, and no merging of thread-local results.
+
+// Symbolic pass: nonzeros of every row of C = A * B
+vector<int> spgemmSymbolic(const CSRMatrix& A, const CSRMatrix& B) {
+    vector<int> rowNnz(A.rows);
+    #pragma omp parallel
+    {
+        vector<int> marker(B.cols, -1);
+        #pragma omp for schedule(dynamic, 64)
+        for (int i = 0; i < A.rows; ++i) {
+            int count = 0;
+            for (int p = A.rowPtr[i]; p < A.rowPtr[i + 1]; ++p) {
+                int k = A.col[p];
+                for (int q = B.rowPtr[k]; q < B.rowPtr[k + 1]; ++q) {
+                    int j = B.col[q];
+                    if (marker[j] != i) {
+                        marker[j] = i;
+                        count++;
+                    }
+                }
+            }
+            rowNnz[i] = count;
+        }
+    }
+    return rowNnz;
+}
+
+// Numeric pass into the preallocated C
+void spgemmNumeric(const CSRMatrix& A, const CSRMatrix& B, CSRMatrix& C) {
+    #pragma omp parallel
+    {
+        vector<int> marker(B.cols, -1);
+        vector<double> acc(B.cols);
+        #pragma omp for schedule(dynamic, 64)
+        for (int i = 0; i < A.rows; ++i) {
+            int start = C.rowPtr[i], pos = start;
+            for (int p = A.rowPtr[i]; p < A.rowPtr[i + 1]; ++p) {
+                int k = A.col[p];
+                double a = A.val[p];
+                for (int q = B.rowPtr[k]; q < B.rowPtr[k + 1]; ++q) {
+                    int j = B.col[q];
+                    if (marker[j] != i) {
+                        marker[j] = i;
+                        C.col[pos++] = j;
+                        acc[j] = a * B.val[q];
+                    } else {
+                        acc[j] += a * B.val[q];
+                    }
+                }
+            }
+            sort(C.col.begin() + start, C.col.begin() + pos);
+            for (int p = start; p < pos; ++p) {
+                C.val[p] = acc[C.col[p]];
+            }
+        }
+    }
+}
+
+CSRMatrix spgemm(const CSRMatrix& A, const CSRMatrix& B) {
+    CSRMatrix C;
+    C.rows = A.rows;
+    C.cols = B.cols;
+    vector<int> rowNnz = spgemmSymbolic(A, B);
+    C.rowPtr.assign(A.rows + 1, 0);
+    for (int i = 0; i < A.rows; ++i) {
+        C.rowPtr[i + 1] = C.rowPtr[i] + rowNnz[i];
+    }
+    C.col.resize(C.rowPtr[A.rows]);
+    C.val.resize(C.rowPtr[A.rows]);
+    spgemmNumeric(A, B, C);
+    return C;
+}
+
+// --- Dense baseline ---
+
+void denseMatVec(int N, const vector<double>& D, const vector<double>& x, vector<double>& y) {
+    #pragma omp parallel for schedule(static)
+    for (int i = 0; i < N; ++i) {
+        double s = 0.0;
+        for (int j = 0; j < N; ++j) {
+            s += D[(size_t)i * N + j] * x[j];
+        }
+        y[i] = s;
+    }
+}
+
+double maxDiff(const vector<double>& a, const vector<double>& b) {
+    double d = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        d = max(d, fabs(a[i] - b[i]));
+    }
+    return d;
+}
+
+int main() {
+    const int N = 2000;
+    const int SPMV_REPS = 50;
+    double densities[] = {0.0005, 0.001, 0.005, 0.01, 0.05};
+
+    cout << fixed << setprecision(6);
+    cout << "--- Sparse vs Dense (N = " << N << ", " << omp_get_max_threads() << " threads) ---" << endl;
+    cout << "SpMV times are per product (average of " << SPMV_REPS << ")" << endl;
+    cout << setw(9) << "Density" << setw(10) << "nnz(A)" << setw(12) << "CSR MV" << setw(12) << "SELL MV"
+         << setw(12) << "Dense MV" << setw(12) << "SpGEMM" << setw(11) << "nnz(C)" << setw(12) << "Dense MM"
+         << setw(11) << "MV err" << setw(11) << "MM err" << endl;
+
+    for (double density : densities) {
+        CSRMatrix A = randomSparse(N, N, density, 1);
+        CSRMatrix B = randomSparse(N, N, density, 2);
+        SellMatrix S = toSell(A);
+        vector<double> x(N), yCSR(N), ySell(N), yDense(N);
+        for (int i = 0; i < N; ++i) {
+            x[i] = (i % 17) / 17.0;
+        }
+
+        double start = omp_get_wtime();
+        for (int r = 0; r < SPMV_REPS; ++r) {
+            spmvCSR(A, x, yCSR);
+        }
+        double csrTime = (omp_get_wtime() - start) / SPMV_REPS;
+
+        start = omp_get_wtime();
+        for (int r = 0; r < SPMV_REPS; ++r) {
+            spmvSell(S, x, ySell);
+        }
+        double sellTime = (omp_get_wtime() - start) / SPMV_REPS;
+
+        vector<double> Ad = toDense(A), Bd = toDense(B), Cd((size_t)N * N);
+        start = omp_get_wtime();
+        for (int r = 0; r < SPMV_REPS; ++r) {
+            denseMatVec(N, Ad, x, yDense);
+        }
+        double denseMvTime = (omp_get_wtime() - start) / SPMV_REPS;
+
+        start = omp_get_wtime();
+        CSRMatrix C = spgemm(A, B);
+        double spgemmTime = omp_get_wtime() - start;
+
+        start = omp_get_wtime();
+        gemm(N, N, N, Ad.data(), N, Bd.data(), N, Cd.data(), N, 0.0);
+        double denseMmTime = omp_get_wtime() - start;
+
+        double mvErr = max(maxDiff(yCSR, yDense), maxDiff(ySell, yDense));
+        double mmErr = maxDiff(toDense(C), Cd);
+        cout << setw(9) << setprecision(4) << density << setw(10) << A.nnz() << setprecision(6)
+             << setw(12) << csrTime << setw(12) << sellTime << setw(12) << denseMvTime
+             << setw(12) << spgemmTime << setw(11) << C.nnz() << setw(12) << denseMmTime
+             << scientific << setprecision(1) << setw(11) << mvErr << setw(11) << mmErr
+             << fixed << setprecision(6) << endl;
+    }
+
+    return 0;
+}
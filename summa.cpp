@@ -0,0 +1,305 @@
+// Distributed Matrix Multiplication: SUMMA and Cannon (MPI + blocked GEMM)
+//
+// Build: mpicxx -O2 -fopenmp summa.cpp -o summa
+// Run:   mpirun -np 4 ./summa                 (default shapes, both algorithms)
+//        mpirun -np 6 ./summa 777 531 913     (C = A * B with A: M x K, B: K x N)
+//
+// Both algorithms compute C = A * B on a 2D grid of ranks, each rank owning one
+// block of A, B and C, and every local block product goes through gemm() from gemm.h.
+// Dimensions that do not divide by the grid are zero padded: the padded rows and
+// columns contribute nothing, and only the valid part of C is checked.
+//
+// SUMMA (Pr x Pc grid, any P): K is processed in panels. For each panel the ranks
+// holding that column panel of A broadcast it along their grid row, the ranks holding
+// that row panel of B broadcast it along their grid column, and every rank adds
+// Apanel * Bpanel to its C block. Panel t+1 is broadcast with MPI_Ibcast while
+// panel t is being multiplied, so communication hides behind the GEMM.
+//
+// Cannon (q x q grid, q = floor(sqrt(P)), remaining ranks idle): after skewing
+// A left by its row index and B up by its column index, every rank multiplies its
+// blocks and passes A one step left and B one step up, q times. The next blocks
+// are received (Isend/Irecv into spare buffers) while the current ones are multiplied.
+
+#include <iostream>
+#include <vector>
+#include <mpi.h>
+#include <omp.h>
+#include <iomanip>   // For setprecision
+#include <cmath>     // For fabs, sqrt
+#include <cstdlib>   // For atoi
+#include <algorithm> // For min, max, copy
+#include "gemm.h"
+
+using namespace std;
+
+const int PANEL = 128; // Preferred SUMMA panel width
+
+int roundUp(int x, int m) { return (x + m - 1) / m * m; }
+
+int gcd(int a, int b) { return b == 0 ? a : gcd(b, a % b); }
+
+// Deterministic pseudo-random entry of A (which = 0) or B (which = 1), so each
+// rank generates its own blocks; entries outside the real matrix are 0 (padding)
+double entry(int which, int i, int j, int rows, int cols) {
+    if (i >= rows || j >= cols) {
+        return 0.0;
+    }
+    unsigned int h = (unsigned int)i * 2654435761u ^ (unsigned int)j * 40503u ^ (unsigned int)which * 97u;
+    h ^= h >> 13;
+    h *= 1274126177u;
+    h ^= h >> 16;
+    return (h % 2001) / 1000.0 - 1.0; // -1.0 .. 1.0
+}
+
+// Block [r0, r0 + rows) x [c0, c0 + cols) of A or B, row-major
+vector<double> makeBlock(int which, int r0, int c0, int rows, int cols, int R, int C) {
+    vector<double> blk((size_t)rows * cols);
+    #pragma omp parallel for
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            blk[(size_t)i * cols + j] = entry(which, r0 + i, c0 + j, R, C);
+        }
+    }
+    return blk;
+}
+
+// Max |C - A*B| over the valid part of a local C block. The reference uses the full
+// rows of A and columns of B for this block, generated locally, so no rank needs
+// the whole matrices. Also returns max |A*B| for a relative error.
+void checkBlock(const vector<double>& Cblk, int r0, int c0, int mb, int nb, int M, int N, int K,
+                double& err, double& scale) {
+    int rows = max(0, min(mb, M - r0)), cols = max(0, min(nb, N - c0));
+    err = 0.0;
+    scale = 0.0;
+    if (rows == 0 || cols == 0) {
+        return;
+    }
+    vector<double> Arows = makeBlock(0, r0, 0, rows, K, M, K);
+    vector<double> Bcols = makeBlock(1, 0, c0, K, cols, K, N);
+    vector<double> ref((size_t)rows * cols);
+    gemm(rows, cols, K, Arows.data(), K, Bcols.data(), cols, ref.data(), cols, 0.0);
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            double r = ref[(size_t)i * cols + j];
+            err = max(err, fabs(Cblk[(size_t)i * nb + j] - r));
+            scale = max(scale, fabs(r));
+        }
+    }
+}
+
+struct RunResult {
+    double seconds;
+    double relError;
+};
+
+// --- SUMMA on a Pr x Pc grid ---
+RunResult summa(int M, int N, int K) {
+    int P, rank;
+    MPI_Comm_size(MPI_COMM_WORLD, &P);
+    int dims[2] = {0, 0}, periods[2] = {0, 0};
+    MPI_Dims_create(P, 2, dims);
+    int Pr = dims[0], Pc = dims[1];
+    MPI_Comm grid, rowComm, colComm;
+    MPI_Cart_create(MPI_COMM_WORLD, 2, dims, periods, 1, &grid);
+    MPI_Comm_rank(grid, &rank);
+    int coords[2];
+    MPI_Cart_coords(grid, rank, 2, coords);
+    int myRow = coords[0], myCol = coords[1];
+    int keepCols[2] = {0, 1}, keepRows[2] = {1, 0};
+    MPI_Cart_sub(grid, keepCols, &rowComm); // Ranks of my grid row, rank = column
+    MPI_Cart_sub(grid, keepRows, &colComm); // Ranks of my grid column, rank = row
+
+    // Padding: every panel of width w must sit inside one column block of A
+    // (Kp / Pc wide) and one row block of B (Kp / Pr tall), so Kp is a multiple
+    // of lcm(Pr, Pc) * w. The panel count (a multiple of L) is chosen first and
+    // w fitted to it, so K is padded by fewer than `panels` columns
+    int L = Pr / gcd(Pr, Pc) * Pc;
+    int panels = L * ((K + L * PANEL - 1) / (L * PANEL));
+    int w = (panels > 0) ? (K + panels - 1) / panels : 1; // K = 0: no panels
+    int Mp = roundUp(M, Pr), Np = roundUp(N, Pc), Kp = panels * w;
+    int mb = Mp / Pr, nb = Np / Pc, kbA = Kp / Pc, kbB = Kp / Pr;
+
+    vector<double> A = makeBlock(0, myRow * mb, myCol * kbA, mb, kbA, M, K);
+    vector<double> B = makeBlock(1, myRow * kbB, myCol * nb, kbB, nb, K, N);
+    vector<double> C((size_t)mb * nb, 0.0);
+    vector<double> aPanel[2] = {vector<double>((size_t)mb * w), vector<double>((size_t)mb * w)};
+    vector<double> bPanel[2] = {vector<double>((size_t)w * nb), vector<double>((size_t)w * nb)};
+
+    // Start the broadcasts of panel t into buffer slot t % 2
+    auto post = [&](int t, MPI_Request* req) {
+        int k0 = t * w;
+        int rootCol = k0 / kbA, rootRow = k0 / kbB;
+        vector<double>& ap = aPanel[t % 2];
+        vector<double>& bp = bPanel[t % 2];
+        if (myCol == rootCol) {
+            int off = k0 - rootCol * kbA;
+            for (int i = 0; i < mb; ++i) {
+                copy(&A[(size_t)i * kbA + off], &A[(size_t)i * kbA + off] + w, &ap[(size_t)i * w]);
+            }
+        }
+        if (myRow == rootRow) {
+            int off = k0 - rootRow * kbB;
+            copy(&B[(size_t)off * nb], &B[(size_t)(off + w) * nb], bp.begin());
+        }
+        MPI_Ibcast(ap.data(), mb * w, MPI_DOUBLE, rootCol, rowComm, &req[0]);
+        MPI_Ibcast(bp.data(), w * nb, MPI_DOUBLE, rootRow, colComm, &req[1]);
+    };
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    double start = MPI_Wtime();
+    MPI_Request req[2][2];
+    post(0, req[0]);
+    for (int t = 0; t < panels; ++t) {
+        MPI_Waitall(2, req[t % 2], MPI_STATUSES_IGNORE);
+        if (t + 1 < panels) {
+            post(t + 1, req[(t + 1) % 2]); // In flight during the multiply below
+        }
+        gemm(mb, nb, w, aPanel[t % 2].data(), w, bPanel[t % 2].data(), nb, C.data(), nb, 1.0);
+    }
+    double elapsed = MPI_Wtime() - start, seconds;
+    MPI_Reduce(&elapsed, &seconds, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+
+    double err, scale, maxErr, maxScale;
+    checkBlock(C, myRow * mb, myCol * nb, mb, nb, M, N, K, err, scale);
+    MPI_Reduce(&err, &maxErr, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    MPI_Reduce(&scale, &maxScale, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+
+    MPI_Comm_free(&rowComm);
+    MPI_Comm_free(&colComm);
+    MPI_Comm_free(&grid);
+    return {seconds, maxErr / max(maxScale, 1e-300)};
+}
+
+// --- Cannon on a q x q grid ---
+RunResult cannon(int M, int N, int K) {
+    int P, worldRank;
+    MPI_Comm_size(MPI_COMM_WORLD, &P);
+    MPI_Comm_rank(MPI_COMM_WORLD, &worldRank);
+    int q = (int)sqrt((double)P);
+    while ((q + 1) * (q + 1) <= P) {
+        q++;
+    }
+    while (q * q > P) {
+        q--;
+    }
+
+    // Ranks beyond q*q sit this one out
+    MPI_Comm active;
+    MPI_Comm_split(MPI_COMM_WORLD, worldRank < q * q ? 0 : MPI_UNDEFINED, worldRank, &active);
+    double seconds = 0.0, maxErr = 0.0, maxScale = 0.0;
+    double err = 0.0, scale = 0.0, elapsed = 0.0;
+
+    if (active != MPI_COMM_NULL) {
+        int dims[2] = {q, q}, periods[2] = {1, 1};
+        MPI_Comm grid;
+        MPI_Cart_create(active, 2, dims, periods, 1, &grid);
+        int rank, coords[2];
+        MPI_Comm_rank(grid, &rank);
+        MPI_Cart_coords(grid, rank, 2, coords);
+        int myRow = coords[0], myCol = coords[1];
+
+        int Mp = roundUp(M, q), Np = roundUp(N, q), Kp = roundUp(K, q);
+        int mb = Mp / q, nb = Np / q, kb = Kp / q;
+        vector<double> A = makeBlock(0, myRow * mb, myCol * kb, mb, kb, M, K);
+        vector<double> B = makeBlock(1, myRow * kb, myCol * nb, kb, nb, K, N);
+        vector<double> C((size_t)mb * nb, 0.0);
+        vector<double> Anext(A.size()), Bnext(B.size());
+
+        MPI_Barrier(grid);
+        double start = MPI_Wtime();
+
+        // Initial alignment: row i shifts A left by i, column j shifts B up by j
+        int src, dst;
+        MPI_Cart_shift(grid, 1, -myRow, &src, &dst);
+        MPI_Sendrecv_replace(A.data(), mb * kb, MPI_DOUBLE, dst, 0, src, 0, grid, MPI_STATUS_IGNORE);
+        MPI_Cart_shift(grid, 0, -myCol, &src, &dst);
+        MPI_Sendrecv_replace(B.data(), kb * nb, MPI_DOUBLE, dst, 1, src, 1, grid, MPI_STATUS_IGNORE);
+
+        int left, right, up, down;
+        MPI_Cart_shift(grid, 1, -1, &right, &left); // A moves left: receive from the right
+        MPI_Cart_shift(grid, 0, -1, &down, &up);    // B moves up: receive from below
+        for (int step = 0; step < q; ++step) {
+            MPI_Request req[4];
+            int n = 0;
+            if (step + 1 < q) {
+                MPI_Irecv(Anext.data(), mb * kb, MPI_DOUBLE, right, 2, grid, &req[n++]);
+                MPI_Irecv(Bnext.data(), kb * nb, MPI_DOUBLE, down, 3, grid, &req[n++]);
+                MPI_Isend(A.data(), mb * kb, MPI_DOUBLE, left, 2, grid, &req[n++]);
+                MPI_Isend(B.data(), kb * nb, MPI_DOUBLE, up, 3, grid, &req[n++]);
+            }
+            gemm(mb, nb, kb, A.data(), kb, B.data(), nb, C.data(), nb, 1.0);
+            MPI_Waitall(n, req, MPI_STATUSES_IGNORE);
+            if (n > 0) {
+                A.swap(Anext);
+                B.swap(Bnext);
+            }
+        }
+        elapsed = MPI_Wtime() - start;
+        checkBlock(C, myRow * mb, myCol * nb, mb, nb, M, N, K, err, scale);
+        MPI_Comm_free(&grid);
+        MPI_Comm_free(&active);
+    }
+    MPI_Reduce(&elapsed, &seconds, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    MPI_Reduce(&err, &maxErr, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    MPI_Reduce(&scale, &maxScale, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    return {seconds, maxErr / max(maxScale, 1e-300)};
+}
+
+void printRow(const char* name, int M, int N, int K, const RunResult& r) {
+    double gflops = 2.0 * M * (double)N * K / r.seconds / 1e9;
+    cout << setw(10) << name << setw(18) << r.seconds << setw(12) << setprecision(3) << gflops
+         << setw(18) << scientific << r.relError << fixed << setprecision(6)
+         << (r.relError < 1e-12 ? "  PASS" : "  FAIL") << endl;
+}
+
+int main(int argc, char** argv) {
+    // OpenMP threads run inside each rank, but only the main thread calls MPI
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+    int rank, P;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &P);
+    if (provided < MPI_THREAD_FUNNELED) {
+        if (rank == 0) {
+            cerr << "MPI library does not support MPI_THREAD_FUNNELED" << endl;
+        }
+        MPI_Finalize();
+        return 1;
+    }
+
+    vector<vector<int>> shapes;
+    if (argc >= 4) {
+        shapes.push_back({atoi(argv[1]), atoi(argv[2]), atoi(argv[3])});
+    } else {
+        shapes = {{1024, 1024, 1024}, {777, 531, 913}, {101, 1000, 37}};
+    }
+
+    if (rank == 0) {
+        int dims[2] = {0, 0};
+        MPI_Dims_create(P, 2, dims);
+        int q = (int)sqrt((double)P);
+        while ((q + 1) * (q + 1) <= P) {
+            q++;
+        }
+        cout << "--- Distributed Matrix Multiplication (MPI) ---" << endl;
+        cout << "Ranks = " << P << ", SUMMA grid = " << dims[0] << " x " << dims[1]
+             << ", Cannon grid = " << q << " x " << q << ", threads/rank = " << omp_get_max_threads() << endl;
+    }
+
+    for (const vector<int>& s : shapes) {
+        int M = s[0], N = s[1], K = s[2];
+        RunResult rs = summa(M, N, K);
+        RunResult rc = cannon(M, N, K);
+        if (rank == 0) {
+            cout << "\nM = " << M << ", N = " << N << ", K = " << K << endl;
+            cout << setw(10) << "Algorithm" << setw(18) << "Time (s)" << setw(12) << "GFLOPS"
+                 << setw(18) << "Rel. Max Error" << endl;
+            cout << fixed << setprecision(6);
+            printRow("SUMMA", M, N, K, rs);
+            printRow("Cannon", M, N, K, rc);
+        }
+    }
+
+    MPI_Finalize();
+    return 0;
+}